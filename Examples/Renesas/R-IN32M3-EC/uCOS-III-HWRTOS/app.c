@@ -89,6 +89,8 @@ int main ()
 
     CPU_Init();
 
+    Mem_Init();                                                 /* Init memory management, used by OSInit().            */
+
     OSInit(&os_err);
     
     if(os_err != OS_ERR_NONE) {
@@ -145,8 +147,6 @@ static void AppTaskStart(void *p_arg)
     CPU_INT08U dir = 0;
     OS_ERR os_err;
 
-    Mem_Init();                                                      /* Init memory management.                         */
-    
     OS_CPU_SysTickInit(APP_CPU_CLK_FREQ / OS_CFG_TICK_RATE_HZ - 1u); /* Configure system tick.                          */
 
     BSP_Led_On(1u);
@@ -87,6 +87,65 @@
                                                         /*   DEF_ENABLED      Assembly-optimized function(s) ENABLED    */
 
 
+/*
+*********************************************************************************************************
+*                              STATIC MEMORY POOL LOCK-FREE CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_POOL_LOCK_FREE_EN to enable/disable the lock-free free block list of
+*               static memory pools (see 'lib_mem.h  (STATIC) MEMORY POOL DATA TYPES  Note #2').
+*********************************************************************************************************
+*/
+
+                                                        /* Configure lock-free static memory pool (see Note #1) :       */
+#define  LIB_MEM_CFG_POOL_LOCK_FREE_EN  DEF_DISABLED
+                                                        /*   DEF_DISABLED     Lock-free memory pool DISABLED            */
+                                                        /*   DEF_ENABLED      Lock-free memory pool ENABLED             */
+
+
+/*
+*********************************************************************************************************
+*                                DYNAMIC MEMORY POOL TRIM CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_TRIM_EN to enable/disable Mem_DynPoolTrim() (see 'lib_mem.h
+*               DYNAMIC MEMORY POOL DATA TYPE  Note #3').
+*
+*           (2) Configure LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY with the number of blocks allocated each time a
+*               dynamic memory pool grows.
+*********************************************************************************************************
+*/
+
+                                                        /* Configure dynamic memory pool trim (see Note #1) :           */
+#define  LIB_MEM_CFG_DYN_POOL_TRIM_EN   DEF_DISABLED
+                                                        /*   DEF_DISABLED     Dynamic memory pool trim DISABLED         */
+                                                        /*   DEF_ENABLED      Dynamic memory pool trim ENABLED          */
+
+#define  LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY       8u    /* Configure number of blocks per chunk [see Note #2].          */
+
+
+/*
+*********************************************************************************************************
+*                                       TLSF HEAP CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_TLSF_EN to enable/disable the two-level segregated fit heaps (see
+*               'lib_mem.h  TLSF HEAP DATA TYPES').
+*
+*           (2) Configure LIB_MEM_CFG_TLSF_SL_LOG2 with the base-2 logarithm of the number of free lists per
+*               power-of-two size class.
+*
+*           (3) Configure LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 with the base-2 logarithm of the size limit of a
+*               TLSF heap.
+*********************************************************************************************************
+*/
+
+                                                        /* Configure TLSF heaps (see Note #1) :                         */
+#define  LIB_MEM_CFG_TLSF_EN            DEF_DISABLED
+                                                        /*   DEF_DISABLED     TLSF heaps DISABLED                       */
+                                                        /*   DEF_ENABLED      TLSF heaps ENABLED                        */
+
+#define  LIB_MEM_CFG_TLSF_SL_LOG2                 4u    /* Configure number of lists per size class [see Note #2].      */
+#define  LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2          20u    /* Configure heap size limit                [see Note #3].      */
+
+
 /*
 *********************************************************************************************************
 *                                   MEMORY ALLOCATION CONFIGURATION
@@ -41,6 +41,14 @@
 #define OS_CFG_CALLED_FROM_ISR_CHK_EN   1u   /* Enable (1) or Disable (0) check for called from ISR                   */
 #define OS_CFG_DBG_EN                   1u   /* Enable (1) debug code/variables                                       */
 #define OS_CFG_OBJ_TYPE_CHK_EN          1u   /* Enable (1) or Disable (0) object type checking                        */
+#define OS_CFG_POST_ASYNC_EN            1u   /* Include code for the asynchronous posts, OSxxxPostAsync()             */
+#define OS_CFG_PRIO_MAX                64u   /* Number of task priorities, folded onto the 15 HWOS priorities         */
+#define OS_CFG_SCHED_ROUND_ROBIN_EN     1u   /* Include code for Round-Robin scheduling                               */
+#define OS_CFG_STAT_OBJ_EN              1u   /* Enable (1) or Disable (0) post/pend statistics of the kernel objects  */
+
+
+                                             /* ----------------------- DEFERRED INTERRUPT WORK --------------------- */
+#define OS_CFG_INT_DEFER_EN             1u   /* Enable (1) or Disable (0) code generation for OSIntDefer()            */
 
 
                                              /* ----------------------------- EVENT FLAGS --------------------------- */
@@ -50,6 +58,17 @@
 #define OS_CFG_FLAG_PEND_ABORT_EN       1u   /*     Include code for OSFlagPendAbort()                                */
 
 
+                                             /* -------------------------- MEMORY MANAGEMENT ------------------------ */
+#define OS_CFG_MEM_EN                   1u   /* Enable (1) or Disable (0) code generation for MEMORY MANAGER          */
+#define OS_CFG_MEM_BUF_EN               1u   /*     Include buffer chains, see OSMemBufGet()                          */
+#define OS_CFG_MEM_MAG_EN               1u   /*     Include per task magazine caches, see OSMemMagSet()               */
+#define OS_CFG_MEM_MAG_SIZE             8u   /*     Number of blocks held by each magazine                            */
+#define OS_CFG_MEM_MSG_EN               1u   /*     Include zero-copy messages, see OSMemMsgGet()                     */
+#define OS_CFG_MEM_PEND_EN              1u   /*     Include code for OSMemPend()                                      */
+#define OS_CFG_MEM_SLAB_EN              1u   /*     Include code for OSMemSlabAlloc()/OSMemSlabFree()                 */
+#define OS_CFG_MEM_SLAB_CLASS_NBR       4u   /*     Maximum number of slab size classes                               */
+
+
                                              /* --------------------- MUTUAL EXCLUSION SEMAPHORES ------------------- */
 #define OS_CFG_MUTEX_EN                 1u   /* Enable (1) or Disable (0) code generation for MUTEX                   */
 #define OS_CFG_MUTEX_DEL_EN             1u   /*     Include code for OSMutexDel()                                     */
@@ -68,6 +87,7 @@
 
 #define OS_CFG_TASK_CHANGE_PRIO_EN      1u   /* Include code for OSTaskChangePrio()                                   */
 #define OS_CFG_TASK_DEL_EN              1u   /* Include code for OSTaskDel()                                          */
+#define OS_CFG_TASK_DYN_EN              1u   /* Include code for OSTaskCreateDyn() and OSTaskDelDyn()                 */
 #define OS_CFG_TASK_SUSPEND_EN          1u   /* Include code for OSTaskSuspend()                                      */
 
 
@@ -76,4 +96,8 @@
 #define OS_CFG_TIME_DLY_RESUME_EN       1u   /*     Include code for OSTimeDlyResume()                                */
 
 
+                                             /* ----------------------------- WORK QUEUE ---------------------------- */
+#define OS_CFG_WORK_EN                  1u   /* Enable (1) or Disable (0) code generation for the WORK QUEUE          */
+
+
 #endif
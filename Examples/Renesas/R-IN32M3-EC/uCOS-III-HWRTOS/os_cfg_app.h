@@ -54,5 +54,22 @@
                                                             /* ------------------------ TICKS ----------------------- */
 #define  OS_CFG_TICK_RATE_HZ             1000u              /* Tick rate in Hertz (10 to 1000 Hz)                     */
 
+                                                            /* -------------------- DYNAMIC TASKS ------------------- */
+#define  OS_CFG_TASK_DYN_MEM_SIZE       16384u              /* Memory for the dynamic TCBs and stacks (octets)        */
+#define  OS_CFG_TASK_DYN_STK_SIZE_MIN     256u              /* Smallest stack size class (number of CPU_STK elements) */
+#define  OS_CFG_TASK_DYN_STK_CLASS_NBR      4u              /* Number of stack size classes, each twice the previous  */
+
+                                                            /* --------------------- WORK QUEUE --------------------- */
+#define  OS_CFG_WORK_Q_SIZE                32u              /* Number of queued jobs, MUST be a power of 2            */
+#define  OS_CFG_WORK_TASK_NBR               2u              /* Number of worker tasks                                 */
+#define  OS_CFG_WORK_TASK_PRIO             40u              /* Priority of the worker tasks                           */
+#define  OS_CFG_WORK_TASK_STK_SIZE        512u              /* Stack size (number of CPU_STK elements)                */
+
+                                                            /* --------------- DEFERRED INTERRUPT WORK -------------- */
+#define  OS_CFG_INT_DEFER_Q_SIZE           16u              /* Number of deferred jobs per priority, a power of 2     */
+#define  OS_CFG_INT_DEFER_PRIO_NBR          2u              /* Number of deferral priorities                          */
+#define  OS_CFG_INT_DEFER_TASK_PRIO         1u              /* Priority of the deferral task                          */
+#define  OS_CFG_INT_DEFER_TASK_STK_SIZE   512u              /* Stack size (number of CPU_STK elements)                */
+
 
 #endif
@@ -268,6 +268,7 @@ __weak void ECATRST_IRQHandler(void)     { Default_IRQHandler(); }
 
 extern void OS_CPU_HWOSCtxSwHandler (void);
 extern void OS_CPU_PendSVHandler (void);
+extern void OS_CPU_SysTickHandler (void);
 extern void BenchSGIHandler (void);
 
 /*============================================================================*/
@@ -301,7 +302,7 @@ const intvec_elem __vector_table[] =
     DebugMon_Handler,                       /* Debug Monitor Handler */
     0,                                      /* Reserved */
     OS_CPU_PendSVHandler,                   /* PendSV Handler */
-    0,                                      /* SysTick Handler */
+    OS_CPU_SysTickHandler,                  /* SysTick Handler */
 
   /* External Interrupts 1 - 240 */
   /* These are essentially unused, so will all */
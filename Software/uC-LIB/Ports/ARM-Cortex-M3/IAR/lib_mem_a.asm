@@ -54,6 +54,7 @@
 ;********************************************************************************************************
 
         PUBLIC  Mem_Copy
+        PUBLIC  Mem_CmpSwap
 
 
 ;********************************************************************************************************
@@ -302,5 +303,49 @@ Mem_Copy_END:
         BX          LR                      ; return
 
 
+;$PAGE
+;********************************************************************************************************
+;                                            Mem_CmpSwap()
+;
+; Description : Atomically replace a memory word by a new value if it still holds an expected value.
+;
+; Argument(s) : p_val       Pointer to memory word to update.
+;
+;               val_old     Value the memory word is expected to hold.
+;
+;               val_new     Value to store in the memory word.
+;
+; Return(s)   : DEF_OK,   if the memory word held 'val_old' & now holds 'val_new'.
+;
+;               DEF_FAIL, otherwise.
+;
+; Caller(s)   : Mem_PoolBlkGet(),
+;               Mem_PoolBlkFree().
+;
+; Note(s)     : (1) The exclusive monitor is cleared on every exception entry & return, so a store that
+;                   raced with an interrupt or a context switch fails & is retried. Interrupts are NEVER
+;                   disabled.
+;********************************************************************************************************
+
+; CPU_BOOLEAN  Mem_CmpSwap (CPU_INT32U volatile  *p_val,        ;  ==>  R0
+;                           CPU_INT32U            val_old,      ;  ==>  R1
+;                           CPU_INT32U            val_new)      ;  ==>  R2
+
+Mem_CmpSwap:
+        LDREX       R3, [R0]                ; load word & claim exclusive monitor
+        CMP         R3, R1
+        BNE         Mem_CmpSwap_Fail        ; word no longer holds val_old
+        STREX       R3, R2, [R0]            ; store val_new if monitor still claimed
+        CMP         R3, #0
+        BNE         Mem_CmpSwap             ; monitor lost (see Note #1), retry
+        MOV         R0, #1                  ; return DEF_OK
+        BX          LR
+
+Mem_CmpSwap_Fail:
+        CLREX                               ; release exclusive monitor
+        MOV         R0, #0                  ; return DEF_FAIL
+        BX          LR
+
+
         END
 
@@ -72,6 +72,52 @@
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)              /* See 'lib_mem.h  (STATIC) MEMORY POOL  Note #2'.      */
+#define  LIB_MEM_POOL_LINK_END                    0x00000000u   /* Link of last free blk in list.                       */
+#define  LIB_MEM_POOL_LINK_USED                   0xFFFFFFFFu   /* Link of alloc'd blk.                                 */
+
+#define  LIB_MEM_POOL_HEAD_IX_MASK                0x0000FFFFu   /* Head bits holding ix + 1 of first free blk.          */
+#define  LIB_MEM_POOL_HEAD_TAG_INC                0x00010000u   /* Head tag incr for each head update.                  */
+
+#define  LIB_MEM_POOL_BLK_NBR_MAX                     0xFFFEu   /* Max nbr of blks in a lock-free pool.                 */
+#endif
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)                        /* See 'lib_mem.h  TLSF HEAP DATA TYPES  Note #2'.      */
+#define  LIB_MEM_TLSF_BLK_FREE                     DEF_BIT_00   /* Blk is free.                                         */
+#define  LIB_MEM_TLSF_BLK_PREV_FREE                DEF_BIT_01   /* Prev phys blk is free.                               */
+#define  LIB_MEM_TLSF_BLK_STATE_MASK                 (LIB_MEM_TLSF_BLK_FREE | LIB_MEM_TLSF_BLK_PREV_FREE)
+
+                                                                /* Size of hdr of an alloc'd blk.                       */
+#define  LIB_MEM_TLSF_BLK_OVERHEAD                   (sizeof(CPU_SIZE_T))
+                                                                /* Offset of blk data from blk hdr.                     */
+#define  LIB_MEM_TLSF_BLK_DATA_OFFSET                (sizeof(MEM_TLSF_BLK *) + sizeof(CPU_SIZE_T))
+                                                                /* Min blk size, to hold free list ptrs & next hdr.     */
+#define  LIB_MEM_TLSF_BLK_SIZE_MIN                   (sizeof(MEM_TLSF_BLK) - sizeof(MEM_TLSF_BLK *))
+
+#define  LIB_MEM_TLSF_BLK_SIZE_GET(p_blk)         ((p_blk)->Size & ~((CPU_SIZE_T)LIB_MEM_TLSF_BLK_STATE_MASK))
+
+#define  LIB_MEM_TLSF_BLK_TO_PTR(p_blk)           ((void         *)((CPU_INT08U *)(p_blk) + LIB_MEM_TLSF_BLK_DATA_OFFSET))
+
+#define  LIB_MEM_TLSF_BLK_FROM_PTR(p_mem)         ((MEM_TLSF_BLK *)((CPU_INT08U *)(p_mem) - LIB_MEM_TLSF_BLK_DATA_OFFSET))
+
+#define  LIB_MEM_TLSF_BLK_NEXT(p_blk)             ((MEM_TLSF_BLK *)((CPU_INT08U *)LIB_MEM_TLSF_BLK_TO_PTR(p_blk) + \
+                                                                    LIB_MEM_TLSF_BLK_SIZE_GET(p_blk)             - \
+                                                                    LIB_MEM_TLSF_BLK_OVERHEAD))
+
+                                                                /* See 'lib_mem.h  TLSF HEAP DATA TYPES  Note #3'.      */
+#define  LIB_MEM_TLSF_LOCK(p_tlsf)                do { if ((p_tlsf)->LockFnct != DEF_NULL) {                     \
+                                                           (p_tlsf)->LockFnct((p_tlsf)->LockArgPtr);             \
+                                                       } else {                                                  \
+                                                           CPU_CRITICAL_ENTER();                                 \
+                                                       } } while (0)
+
+#define  LIB_MEM_TLSF_UNLOCK(p_tlsf)              do { if ((p_tlsf)->UnlockFnct != DEF_NULL) {                   \
+                                                           (p_tlsf)->UnlockFnct((p_tlsf)->LockArgPtr);           \
+                                                       } else {                                                  \
+                                                           CPU_CRITICAL_EXIT();                                  \
+                                                       } } while (0)
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -160,6 +206,58 @@ static  void          Mem_SegAllocTrackCritical(const  CPU_CHAR      *p_name,
                                                        LIB_ERR       *p_err);
 #endif
 
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+static  void         *Mem_SegChunkAllocCritical(       MEM_SEG       *p_seg,
+                                                       CPU_SIZE_T     size,
+                                                       CPU_SIZE_T     align,
+                                                       CPU_ADDR      *p_seg_addr,
+                                                       CPU_SIZE_T    *p_seg_size,
+                                                       LIB_ERR       *p_err);
+
+static  void          Mem_SegChunkFreeCritical (       MEM_SEG       *p_seg,
+                                                       CPU_ADDR       seg_addr,
+                                                       CPU_SIZE_T     seg_size);
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+static  void          Mem_SegFreeTrackCritical (const  CPU_CHAR      *p_name,
+                                                       MEM_SEG       *p_seg,
+                                                       CPU_SIZE_T     size);
+#endif
+
+static  void         *Mem_DynPoolChunkAdd      (       MEM_DYN_POOL  *p_pool,
+                                                       LIB_ERR       *p_err);
+
+static  MEM_DYN_POOL_CHUNK  *Mem_DynPoolChunkFind (MEM_DYN_POOL_CHUNK  *p_chunk,
+                                                   void                *p_blk,
+                                                   CPU_SIZE_T           hdr_size,
+                                                   CPU_SIZE_T           blk_stride);
+#endif
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void          Mem_TlsfMap              (       CPU_SIZE_T     size,
+                                                       CPU_SIZE_T    *p_fl,
+                                                       CPU_SIZE_T    *p_sl);
+
+static  MEM_TLSF_BLK *Mem_TlsfBlkFind          (       MEM_TLSF      *p_tlsf,
+                                                       CPU_SIZE_T     size);
+
+static  void          Mem_TlsfBlkInsert        (       MEM_TLSF      *p_tlsf,
+                                                       MEM_TLSF_BLK  *p_blk);
+
+static  void          Mem_TlsfBlkRemove        (       MEM_TLSF      *p_tlsf,
+                                                       MEM_TLSF_BLK  *p_blk);
+
+static  MEM_TLSF_BLK *Mem_TlsfBlkMergePrev     (       MEM_TLSF      *p_tlsf,
+                                                       MEM_TLSF_BLK  *p_blk);
+
+static  MEM_TLSF_BLK *Mem_TlsfBlkMergeNext     (       MEM_TLSF      *p_tlsf,
+                                                       MEM_TLSF_BLK  *p_blk);
+
+static  void          Mem_TlsfBlkTrim          (       MEM_TLSF      *p_tlsf,
+                                                       MEM_TLSF_BLK  *p_blk,
+                                                       CPU_SIZE_T     size);
+#endif
+
 #if ((LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) && \
      (LIB_MEM_CFG_HEAP_SIZE      >  0u))
 static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
@@ -484,6 +582,55 @@ void  Mem_Copy (       void        *pdest,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                            Mem_CmpSwap()
+*
+* Description : Atomically replaces a memory word by a new value if it still holds an expected value.
+*
+* Argument(s) : p_val       Pointer to memory word to update.
+*
+*               val_old     Value the memory word is expected to hold.
+*
+*               val_new     Value to store in the memory word.
+*
+* Return(s)   : DEF_OK,   if the memory word held 'val_old' & now holds 'val_new'.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Mem_PoolBlkGet(),
+*               Mem_PoolBlkFree().
+*
+* Note(s)     : (1) The assembly version (see 'lib_mem_a.asm') uses exclusive load/store instructions & does
+*                   NOT disable interrupts. This C version ONLY disables interrupts for the compare & the
+*                   store, which still keeps the memory pool critical sections independent of pool size.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_OPTIMIZE_ASM_EN   != DEF_ENABLED))
+CPU_BOOLEAN  Mem_CmpSwap (CPU_INT32U volatile  *p_val,
+                          CPU_INT32U            val_old,
+                          CPU_INT32U            val_new)
+{
+    CPU_BOOLEAN  swapped;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (*p_val == val_old) {
+       *p_val   = val_new;
+        swapped = DEF_OK;
+    } else {
+        swapped = DEF_FAIL;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (swapped);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             Mem_Move()
@@ -984,7 +1131,10 @@ void  Mem_SegClr (MEM_SEG  *p_seg,
 #endif
 
     CPU_CRITICAL_ENTER();
-    p_seg->AddrNext = p_seg->AddrBase;
+    p_seg->AddrNext    = p_seg->AddrBase;
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+    p_seg->FreeHeadPtr = DEF_NULL;
+#endif
     CPU_CRITICAL_EXIT();
 
    *p_err = LIB_MEM_ERR_NONE;
@@ -1363,7 +1513,9 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
     CPU_SIZE_T         blk_size_align;
     CPU_ADDR           pool_addr_end;
     MEM_POOL_BLK_QTY   blk_ix;
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN != DEF_ENABLED)
     CPU_INT08U        *p_blk;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -1401,6 +1553,13 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
     }
 #endif
 
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    if (blk_nbr > LIB_MEM_POOL_BLK_NBR_MAX) {                   /* Blk ix MUST fit in free list head.                   */
+       *p_err = LIB_MEM_ERR_INVALID_BLK_NBR;
+        return;
+    }
+#endif
+
     Mem_PoolClr(p_pool, p_err);                                 /* Init mem pool.                                       */
     if (*p_err != LIB_MEM_ERR_NONE) {
          return;
@@ -1476,6 +1635,27 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
         return;
     }
 
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+                                                                /* ------------ ALLOC MEM FOR BLK LINK TBL ------------ */
+    p_pool->BlkLinkTbl = (CPU_INT32U *)Mem_SegAllocInternal("Unnamed static pool blk link tbl",
+                                                            &Mem_SegHeap,
+                                                             blk_nbr * sizeof(CPU_INT32U),
+                                                             sizeof(CPU_ALIGN),
+                                                             LIB_MEM_PADDING_ALIGN_NONE,
+                                                             p_bytes_reqd,
+                                                             p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------------ INIT BLK LIST ------------------- */
+    for (blk_ix = 0u; blk_ix < (blk_nbr - 1u); blk_ix++) {      /* Link each blk to the next one ...                    */
+        p_pool->BlkLinkTbl[blk_ix] = blk_ix + 2u;
+    }
+    p_pool->BlkLinkTbl[blk_ix] = LIB_MEM_POOL_LINK_END;         /* ... & end list on last blk.                          */
+    p_pool->BlkFreeHead        = 1u;                            /* First free blk is blk #0, with a null tag.           */
+    p_pool->BlkFreeCtr         = blk_nbr;
+#else
                                                                 /* ------------ ALLOC MEM FOR FREE BLK TBL ------------ */
     p_pool->BlkFreeTbl = (void *)Mem_SegAllocInternal("Unnamed static pool free blk tbl",
                                                       &Mem_SegHeap,
@@ -1494,6 +1674,8 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
         p_pool->BlkFreeTbl[blk_ix]  = p_blk;
         p_blk                      += blk_size_align;
     }
+    p_pool->BlkFreeTblIx = blk_nbr;
+#endif
 
 
                                                                 /* ------------------ INIT POOL DATA ------------------ */
@@ -1502,7 +1684,6 @@ void  Mem_PoolCreate (MEM_POOL          *p_pool,
     p_pool->PoolAddrEnd   = (void *)pool_addr_end;
     p_pool->BlkNbr        =  blk_nbr;
     p_pool->BlkSize       =  blk_size_align;
-    p_pool->BlkFreeTblIx  =  blk_nbr;
 }
 #endif
 
@@ -1558,8 +1739,14 @@ void  Mem_PoolClr (MEM_POOL  *p_pool,
     p_pool->PoolAddrEnd   = DEF_NULL;
     p_pool->BlkSize       = 0u;
     p_pool->BlkNbr        = 0u;
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    p_pool->BlkLinkTbl    = DEF_NULL;
+    p_pool->BlkFreeHead   = LIB_MEM_POOL_LINK_END;
+    p_pool->BlkFreeCtr    = 0u;
+#else
     p_pool->BlkFreeTbl    = DEF_NULL;
     p_pool->BlkFreeTblIx  = 0u;
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -1591,6 +1778,14 @@ void  Mem_PoolClr (MEM_POOL  *p_pool,
 *
 * Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
 *                   Mem_DynPoolBlkGet() should be used instead.
+*
+*               (2) When LIB_MEM_CFG_POOL_LOCK_FREE_EN is ENABLED (see 'lib_mem.h  (STATIC) MEMORY POOL DATA
+*                   TYPES  Note #2') :
+*
+*                   (a) The first free block is popped with a compare-and-swap of the tagged list head; a
+*                       concurrent get or free from a task or an ISR makes the swap fail & the pop is retried.
+*
+*                   (b) The block's link is only marked as allocated once the block is owned by the caller.
 *********************************************************************************************************
 */
 
@@ -1600,7 +1795,14 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
                        LIB_ERR     *p_err)
 {
     CPU_INT08U  *p_blk;
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U   head;
+    CPU_INT32U   head_new;
+    CPU_INT32U   blk_ix;
+    CPU_INT32U   ctr;
+#else
     CPU_SR_ALLOC();
+#endif
 
 
    (void)&size;                                                 /* Prevent possible 'variable unused' warning.          */
@@ -1628,6 +1830,27 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
 
 
                                                                 /* -------------- GET MEM BLK FROM POOL --------------- */
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    do {                                                        /* Pop first free blk (see Note #2a).                   */
+        head   = p_pool->BlkFreeHead;
+        blk_ix = head & LIB_MEM_POOL_HEAD_IX_MASK;
+        if (blk_ix == LIB_MEM_POOL_LINK_END) {
+           *p_err = LIB_MEM_ERR_POOL_EMPTY;
+            return (DEF_NULL);
+        }
+        blk_ix  -= 1u;
+        head_new = ((head & ~LIB_MEM_POOL_HEAD_IX_MASK) + LIB_MEM_POOL_HEAD_TAG_INC) |
+                    (p_pool->BlkLinkTbl[blk_ix] & LIB_MEM_POOL_HEAD_IX_MASK);
+    } while (Mem_CmpSwap(&p_pool->BlkFreeHead, head, head_new) != DEF_OK);
+
+    p_pool->BlkLinkTbl[blk_ix] = LIB_MEM_POOL_LINK_USED;        /* Mark blk as alloc'd (see Note #2b).                  */
+
+    do {
+        ctr = p_pool->BlkFreeCtr;
+    } while (Mem_CmpSwap(&p_pool->BlkFreeCtr, ctr, ctr - 1u) != DEF_OK);
+
+    p_blk = (CPU_INT08U *)p_pool->PoolAddrStart + (blk_ix * p_pool->BlkSize);
+#else
     p_blk = DEF_NULL;
     CPU_CRITICAL_ENTER();
     if (p_pool->BlkFreeTblIx > 0u) {
@@ -1636,6 +1859,7 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
         p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx]  = DEF_NULL;
     }
     CPU_CRITICAL_EXIT();
+#endif
 
     if (p_blk == DEF_NULL) {
        *p_err = LIB_MEM_ERR_POOL_EMPTY;
@@ -1674,6 +1898,16 @@ void  *Mem_PoolBlkGet (MEM_POOL    *p_pool,
 *
 * Note(s)     : (1) This function is DEPRECATED and will be removed in a future version of this product.
 *                   Mem_DynPoolBlkFree() should be used instead.
+*
+*               (2) When LIB_MEM_CFG_POOL_LOCK_FREE_EN is ENABLED (see 'lib_mem.h  (STATIC) MEMORY POOL DATA
+*                   TYPES  Note #2') :
+*
+*                   (a) The block index is derived from the block address. The block's link is swapped from
+*                       allocated to free, which detects a double free without scanning the pool & without
+*                       disabling interrupts.
+*
+*                   (b) The free block counter is incremented before the block is pushed, so a concurrent
+*                       get can NOT decrement it below zero.
 *********************************************************************************************************
 */
 
@@ -1682,11 +1916,21 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
                        void      *p_blk,
                        LIB_ERR   *p_err)
 {
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U   head;
+    CPU_INT32U   head_new;
+    CPU_INT32U   blk_ix;
+    CPU_INT32U   ctr;
+#endif
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN != DEF_ENABLED)
     CPU_SIZE_T   tbl_ix;
+#endif
     CPU_BOOLEAN  addr_valid;
 #endif
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN != DEF_ENABLED)
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* -------------- VALIDATE MEM POOL FREE -------------- */
@@ -1709,7 +1953,30 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
        *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
         return;
     }
+#endif
+
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+                                                                /* --------------- FREE MEM BLK TO POOL --------------- */
+    blk_ix = (CPU_INT32U)(((CPU_ADDR)p_blk - (CPU_ADDR)p_pool->PoolAddrStart) / p_pool->BlkSize);
+
+                                                                /* Claim blk, unless already free (see Note #2a).       */
+    if (Mem_CmpSwap(&p_pool->BlkLinkTbl[blk_ix], LIB_MEM_POOL_LINK_USED, LIB_MEM_POOL_LINK_END) != DEF_OK) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return;
+    }
+
+    do {                                                        /* Count blk before it can be popped (see Note #2b).    */
+        ctr = p_pool->BlkFreeCtr;
+    } while (Mem_CmpSwap(&p_pool->BlkFreeCtr, ctr, ctr + 1u) != DEF_OK);
 
+    do {                                                        /* Push blk as first free blk.                          */
+        head                       = p_pool->BlkFreeHead;
+        p_pool->BlkLinkTbl[blk_ix] = head & LIB_MEM_POOL_HEAD_IX_MASK;
+        head_new                   = ((head & ~LIB_MEM_POOL_HEAD_IX_MASK) + LIB_MEM_POOL_HEAD_TAG_INC) |
+                                      (blk_ix + 1u);
+    } while (Mem_CmpSwap(&p_pool->BlkFreeHead, head, head_new) != DEF_OK);
+#else
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     CPU_CRITICAL_ENTER();                                       /* Make sure blk isn't already in free list.            */
     for (tbl_ix = 0u; tbl_ix < p_pool->BlkNbr; tbl_ix++) {
         if (p_pool->BlkFreeTbl[tbl_ix] == p_blk) {
@@ -1731,6 +1998,7 @@ void  Mem_PoolBlkFree (MEM_POOL  *p_pool,
     p_pool->BlkFreeTbl[p_pool->BlkFreeTblIx]  = p_blk;
     p_pool->BlkFreeTblIx                     += 1u;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 }
@@ -1766,7 +2034,9 @@ MEM_POOL_BLK_QTY  Mem_PoolBlkGetNbrAvail (MEM_POOL  *p_pool,
                                           LIB_ERR   *p_err)
 {
     CPU_SIZE_T  nbr_avail;
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN != DEF_ENABLED)
     CPU_SR_ALLOC();
+#endif
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
@@ -1781,9 +2051,13 @@ MEM_POOL_BLK_QTY  Mem_PoolBlkGetNbrAvail (MEM_POOL  *p_pool,
     }
 #endif
 
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    nbr_avail = p_pool->BlkFreeCtr;
+#else
     CPU_CRITICAL_ENTER();
     nbr_avail = p_pool->BlkFreeTblIx;
     CPU_CRITICAL_EXIT();
+#endif
 
    *p_err = LIB_MEM_ERR_NONE;
 
@@ -1965,7 +2239,9 @@ void  Mem_DynPoolCreateHW (const  CPU_CHAR      *p_name,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) When LIB_MEM_CFG_DYN_POOL_TRIM_EN is ENABLED, an empty pool grows by a whole chunk of
+*                   blocks (see 'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #3'); the first block is
+*                   returned & the others are added to the free list.
 *********************************************************************************************************
 */
 
@@ -1973,7 +2249,9 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
                           LIB_ERR       *p_err)
 {
            void      *p_blk;
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN != DEF_ENABLED)
     const  CPU_CHAR  *p_pool_name;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -2016,6 +2294,9 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
     CPU_CRITICAL_EXIT();
 
                                                                 /* ------------------ ALLOC NEW BLK ------------------- */
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+    p_blk = Mem_DynPoolChunkAdd(p_pool, p_err);                 /* Grow pool by a chunk of blks (see Note #1).          */
+#else
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     p_pool_name = p_pool->NamePtr;
 #else
@@ -2028,6 +2309,7 @@ void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
                                  p_pool->BlkPaddingAlign,
                                  DEF_NULL,
                                  p_err);
+#endif
     if (*p_err != LIB_MEM_ERR_NONE) {
         return (DEF_NULL);
     }
@@ -2165,166 +2447,846 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 
 /*
 *********************************************************************************************************
-*                                           Mem_OutputUsage()
+*                                          Mem_DynPoolTrim()
 *
-* Description : Outputs memory usage report through 'out_fnct'.
+* Description : Returns the chunks of a dynamic memory pool whose blocks are all free to the pool's memory
+*               segment.
 *
-* Argument(s) : out_fnct        Pointer to output function.
+* Argument(s) : p_pool          Pointer to pool data.
 *
-*               print_details   DEF_YES, if the size of each allocation should be printed.
-*                               DEF_NO,  otherwise.
+*               blk_qty_keep    Number of free blocks to keep in the pool, if available.
 *
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
 *                                   LIB_MEM_ERR_NONE                Operation was successful.
-*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
-*
-*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
-*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
-*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*                                   LIB_MEM_ERR_NULL_PTR            'p_pool' pointer passed is NULL.
 *
-* Return(s)   : None.
+* Return(s)   : Number of blocks returned to the memory segment.
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) The free list is detached from the pool while it is scanned, so interrupts are only
+*                   disabled to detach it & to re-attach the kept blocks & release the trimmed chunks. A
+*                   block get issued during the scan finds the pool empty & grows it by a new chunk.
+*
+*               (2) Blocks allocated at pool creation are NOT part of any chunk & are always kept (see
+*                   'lib_mem.h  DYNAMIC MEMORY POOL DATA TYPE  Note #3').
+*
+*               (3) A chunk's 'BlkFreeCnt' is only meaningful during the trim : after the free blocks have
+*                   been counted, it is left equal to 'BlkQty' for chunks to release & cleared otherwise.
+*
+*               (4) This function MUST NOT be called concurrently for the same pool.
 *********************************************************************************************************
 */
 
-#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
-void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
-                      LIB_ERR   *p_err)
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+CPU_SIZE_T  Mem_DynPoolTrim (MEM_DYN_POOL  *p_pool,
+                             CPU_SIZE_T     blk_qty_keep,
+                             LIB_ERR       *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
-    MEM_SEG   *p_seg;
+    MEM_DYN_POOL_CHUNK  *p_chunk_head;
+    MEM_DYN_POOL_CHUNK  *p_chunk;
+    MEM_DYN_POOL_CHUNK  *p_chunk_prev;
+    MEM_DYN_POOL_CHUNK  *p_chunk_next;
+    void                *p_blk;
+    void                *p_blk_next;
+    void                *p_keep_head;
+    void                *p_keep_tail;
+    CPU_SIZE_T           blk_align;
+    CPU_SIZE_T           blk_stride;
+    CPU_SIZE_T           hdr_size;
+    CPU_SIZE_T           blk_qty_free;
+    CPU_SIZE_T           blk_qty_trim;
     CPU_SR_ALLOC();
 
 
 #if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
-        CPU_SW_EXCEPTION(;);
+        CPU_SW_EXCEPTION(0u);
     }
 
-    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
        *p_err = LIB_MEM_ERR_NULL_PTR;
-        return;
+        return (0u);
     }
 #endif
 
-    out_fnct("---------------- Memory allocation info ----------------\r\n");
-    out_fnct("| Type    | Size       | Free size  | Name\r\n");
-    out_fnct("|---------|------------|------------|-------------------\r\n");
+                                                                /* Same layout as Mem_DynPoolChunkAdd().                */
+    blk_align  = DEF_MAX(p_pool->BlkAlign, p_pool->BlkPaddingAlign);
+    blk_stride = MATH_ROUND_INC_UP_PWR2(DEF_MAX(p_pool->BlkSize, sizeof(void *)), blk_align);
+    hdr_size   = MATH_ROUND_INC_UP_PWR2(sizeof(MEM_DYN_POOL_CHUNK), DEF_MAX(blk_align, sizeof(CPU_ALIGN)));
 
-    CPU_CRITICAL_ENTER();
-    p_seg = Mem_SegHeadPtr;
-    while (p_seg != DEF_NULL) {
-        CPU_SIZE_T       rem_size;
-        MEM_SEG_INFO     seg_info;
-        MEM_ALLOC_INFO  *p_alloc;
+                                                                /* ----------------- DETACH FREE LIST ----------------- */
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    p_blk              = p_pool->BlkFreePtr;
+    p_pool->BlkFreePtr = DEF_NULL;
+    p_chunk_head       = p_pool->ChunkHeadPtr;
+    CPU_CRITICAL_EXIT();
 
+                                                                /* ------------- CNT FREE BLKS PER CHUNK -------------- */
+    for (p_chunk = p_chunk_head; p_chunk != DEF_NULL; p_chunk = p_chunk->NextPtr) {
+        p_chunk->BlkFreeCnt = 0u;
+    }
 
-        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
-        if (*p_err != LIB_MEM_ERR_NONE) {
-            return;
+    p_keep_head  = p_blk;
+    blk_qty_free = 0u;
+    while (p_blk != DEF_NULL) {
+        p_chunk = Mem_DynPoolChunkFind(p_chunk_head, p_blk, hdr_size, blk_stride);
+        if (p_chunk != DEF_NULL) {                              /* Blks alloc'd at creation have no chunk (see Note #2).*/
+            p_chunk->BlkFreeCnt++;
         }
+        blk_qty_free++;
+        p_blk = *((void **)p_blk);
+    }
 
-        out_fnct("| Section | ");
-
-        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct(" | ");
-
-        (void)Str_FmtNbr_Int32U(rem_size,
-                                10u,
-                                DEF_NBR_BASE_DEC,
-                                ' ',
-                                DEF_NO,
-                                DEF_YES,
-                               &str[0u]);
-
-        out_fnct(str);
-        out_fnct(" | ");
-        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
-        out_fnct("\r\n");
-
-        p_alloc = p_seg->AllocInfoHeadPtr;
-        while (p_alloc != DEF_NULL) {
-            out_fnct("| -> Obj  | ");
-
-            (void)Str_FmtNbr_Int32U(p_alloc->Size,
-                                    10u,
-                                    DEF_NBR_BASE_DEC,
-                                    ' ',
-                                    DEF_NO,
-                                    DEF_YES,
-                                   &str[0u]);
+                                                                /* -------------- SEL CHUNKS TO RELEASE --------------- */
+    blk_qty_trim = 0u;
+    for (p_chunk = p_chunk_head; p_chunk != DEF_NULL; p_chunk = p_chunk->NextPtr) {
+        if ((p_chunk->BlkFreeCnt         == p_chunk->BlkQty) &&
+            ((blk_qty_free - blk_qty_trim) >= (blk_qty_keep + p_chunk->BlkQty))) {
+            blk_qty_trim += p_chunk->BlkQty;                    /* Release chunk (see Note #3).                         */
+        } else {
+            p_chunk->BlkFreeCnt = 0u;                           /* Keep    chunk.                                       */
+        }
+    }
 
-            out_fnct(str);
-            out_fnct(" |            | ");
+                                                                /* ----------- UNLINK BLKS OF TRIMMED CHUNKS ---------- */
+    p_blk       = p_keep_head;
+    p_keep_head = DEF_NULL;
+    p_keep_tail = DEF_NULL;
+    while (p_blk != DEF_NULL) {
+        p_blk_next = *((void **)p_blk);
+        p_chunk    =  Mem_DynPoolChunkFind(p_chunk_head, p_blk, hdr_size, blk_stride);
+        if ((p_chunk == DEF_NULL) || (p_chunk->BlkFreeCnt == 0u)) {
+            if (p_keep_tail == DEF_NULL) {
+                p_keep_head = p_blk;
+            } else {
+               *((void **)p_keep_tail) = p_blk;
+            }
+            p_keep_tail = p_blk;
+        }
+        p_blk = p_blk_next;
+    }
 
-            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
-            out_fnct("\r\n");
+                                                                /* ------- RE-ATTACH KEPT BLKS & RELEASE CHUNKS ------- */
+    CPU_CRITICAL_ENTER();
+    if (p_keep_tail != DEF_NULL) {
+       *((void **)p_keep_tail) = p_pool->BlkFreePtr;
+        p_pool->BlkFreePtr     = p_keep_head;
+    }
 
-            p_alloc = p_alloc->NextPtr;
+    p_chunk_prev = DEF_NULL;
+    p_chunk      = p_pool->ChunkHeadPtr;                        /* Chunks added during trim are kept (cnt is 0).        */
+    while (p_chunk != DEF_NULL) {
+        p_chunk_next = p_chunk->NextPtr;
+        if (p_chunk->BlkFreeCnt != 0u) {
+            if (p_chunk_prev == DEF_NULL) {
+                p_pool->ChunkHeadPtr  = p_chunk_next;
+            } else {
+                p_chunk_prev->NextPtr = p_chunk_next;
+            }
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+            Mem_SegFreeTrackCritical(p_pool->NamePtr,
+                                     p_pool->PoolSegPtr,
+                                     p_chunk->SegSize);
+#endif
+            Mem_SegChunkFreeCritical(p_pool->PoolSegPtr,        /* Chunk hdr is overwritten by seg free region hdr.     */
+                                     p_chunk->SegAddr,
+                                     p_chunk->SegSize);
+        } else {
+            p_chunk_prev = p_chunk;
         }
-
-        p_seg = p_seg->NextPtr;
+        p_chunk = p_chunk_next;
     }
     CPU_CRITICAL_EXIT();
 
    *p_err = LIB_MEM_ERR_NONE;
+
+    return (blk_qty_trim);
 }
 #endif
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                       Mem_SegCreateCritical()
+*                                          Mem_TlsfCreate()
 *
-* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+* Description : Creates a TLSF heap over a region allocated from a memory segment.
 *
-* Argument(s) : p_name          Pointer to segment name.
+* Argument(s) : p_name          Pointer to heap name.
 *
-*               p_seg           Pointer to segment data. Must be allocated by caller.
-*               -----           Argument validated by caller.
+*               p_tlsf          Pointer to heap data.
 *
-*               seg_base_addr   Segment's first byte address.
+*               p_seg           Pointer to segment from which to allocate heap region. Will be allocated from
+*                               general-purpose heap if null.
 *
-*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
-*                               from this memory segment. MUST be a power of 2.
-*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
-*               -------------   Argument validated by caller.
+*               size            Size of heap region, in bytes. See Note #1.
 *
-*               size            Total size of segment, in bytes.
-*               ----            Argument validated by caller.
+*               lock_fnct       Function that locks the heap, or DEF_NULL to use critical sections. See Note #2.
 *
-* Return(s)   : Pointer to segment data, if successful.
+*               unlock_fnct     Function that unlocks the heap, or DEF_NULL to use critical sections.
 *
-*               DEF_NULL, otherwise.
+*               p_lock_arg      Argument passed to 'lock_fnct' & 'unlock_fnct'.
 *
-* Caller(s)   : Mem_PoolCreate(),
-*               Mem_SegCreate().
+*               p_err           Pointer to variable that will receive the return error code from this function :
 *
-* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            Heap data pointer NULL or only one lock
+*                                                                       function specified.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid heap region size specified.
+*
+*                                   ------------------RETURNED BY Mem_SegAllocInternal()-------------------
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) 'size' is rounded down to a multiple of LIB_MEM_TLSF_ALIGN & MUST be lower than
+*                   LIB_MEM_TLSF_SIZE_MAX. Two block headers are taken from the region : one for the initial
+*                   free block & one for the zero-sized sentinel block that ends the heap.
+*
+*               (2) 'lock_fnct' & 'unlock_fnct' typically pend on & post a kernel mutex, so that heap operations
+*                   do NOT disable interrupts. Such a heap MUST NOT be used from an ISR. Both functions MUST be
+*                   specified or both left DEF_NULL.
 *********************************************************************************************************
 */
 
-static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TlsfCreate (const  CPU_CHAR            *p_name,
+                             MEM_TLSF            *p_tlsf,
+                             MEM_SEG             *p_seg,
+                             CPU_SIZE_T           size,
+                             MEM_TLSF_LOCK_FNCT   lock_fnct,
+                             MEM_TLSF_LOCK_FNCT   unlock_fnct,
+                             void                *p_lock_arg,
+                             LIB_ERR             *p_err)
+{
+    CPU_INT08U    *p_mem;
+    MEM_TLSF_BLK  *p_blk;
+    MEM_TLSF_BLK  *p_blk_end;
+    CPU_SIZE_T     blk_size;
+    CPU_SIZE_T     fl;
+    CPU_SIZE_T     sl;
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_tlsf == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if ((lock_fnct   == DEF_NULL) !=                            /* Chk that both lock fncts are set or none.            */
+        (unlock_fnct == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (p_seg == DEF_NULL) {                                    /* Alloc from heap if p_seg is null.                    */
+#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
+        p_seg = &Mem_SegHeap;
+#else
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+#endif
+    }
+
+    size     = size & ~((CPU_SIZE_T)LIB_MEM_TLSF_ALIGN - 1u);   /* See Note #1.                                         */
+    blk_size = size - (2u * LIB_MEM_TLSF_BLK_OVERHEAD);
+    if ((size     <  (2u * LIB_MEM_TLSF_BLK_OVERHEAD) + LIB_MEM_TLSF_BLK_SIZE_MIN) ||
+        (blk_size >= LIB_MEM_TLSF_SIZE_MAX)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return;
+    }
+
+    p_mem = (CPU_INT08U *)Mem_SegAllocInternal(p_name,
+                                               p_seg,
+                                               size,
+                                               LIB_MEM_TLSF_ALIGN,
+                                               LIB_MEM_PADDING_ALIGN_NONE,
+                                               DEF_NULL,
+                                               p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ------------------ INIT FREE LISTS ----------------- */
+    p_tlsf->BlkNull.NextFreePtr = &p_tlsf->BlkNull;
+    p_tlsf->BlkNull.PrevFreePtr = &p_tlsf->BlkNull;
+    p_tlsf->FL_Bitmap           =  0u;
+    for (fl = 0u; fl < LIB_MEM_TLSF_FL_CNT; fl++) {
+        p_tlsf->SL_BitmapTbl[fl] = 0u;
+        for (sl = 0u; sl < LIB_MEM_TLSF_SL_CNT; sl++) {
+            p_tlsf->BlkFreeTbl[fl][sl] = &p_tlsf->BlkNull;
+        }
+    }
+
+                                                                /* ----------------- INIT HEAP REGION ----------------- */
+                                                                /* Blk's prev phys ptr lies before region & is unused.  */
+    p_blk       = (MEM_TLSF_BLK *)(p_mem - LIB_MEM_TLSF_BLK_OVERHEAD);
+    p_blk->Size =  blk_size | LIB_MEM_TLSF_BLK_FREE;
+    Mem_TlsfBlkInsert(p_tlsf, p_blk);
+
+    p_blk_end              = LIB_MEM_TLSF_BLK_NEXT(p_blk);      /* Sentinel blk, never free, ends the heap.             */
+    p_blk_end->PrevPhysPtr = p_blk;
+    p_blk_end->Size        = LIB_MEM_TLSF_BLK_PREV_FREE;
+
+    p_tlsf->AddrStart  = (CPU_ADDR)p_mem;
+    p_tlsf->AddrEnd    = (CPU_ADDR)p_mem + (size - 1u);
+
+    p_tlsf->LockFnct   = lock_fnct;
+    p_tlsf->UnlockFnct = unlock_fnct;
+    p_tlsf->LockArgPtr = p_lock_arg;
+
+    p_tlsf->Stat.SizeTot      = size;
+    p_tlsf->Stat.SizeUsed     = 0u;
+    p_tlsf->Stat.SizeUsedMax  = 0u;
+    p_tlsf->Stat.BlkUsedCnt   = 0u;
+    p_tlsf->Stat.AllocFailCtr = 0u;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_tlsf->NamePtr = p_name;
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_TlsfAlloc()
+*
+* Description : Allocates a memory block from a TLSF heap.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*
+*               size    Size of memory block to allocate, in bytes.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                    Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                Heap data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE        Invalid memory block size specified.
+*                           LIB_MEM_ERR_HEAP_EMPTY              No free block large enough in heap.
+*
+* Return(s)   : Pointer to memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application,
+*               Mem_TlsfRealloc().
+*
+* Note(s)     : (1) The memory block is aligned on LIB_MEM_TLSF_ALIGN bytes.
+*
+*               (2) The search & the split of the found block take a bounded number of steps, whatever the
+*                   number & the sizes of the heap's blocks (see 'lib_mem.h  TLSF HEAP DATA TYPES  Note #1').
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  *Mem_TlsfAlloc (MEM_TLSF    *p_tlsf,
+                      CPU_SIZE_T   size,
+                      LIB_ERR     *p_err)
+{
+    MEM_TLSF_BLK  *p_blk;
+    MEM_TLSF_BLK  *p_blk_next;
+    CPU_SIZE_T     size_blk;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_tlsf == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if ((size <  1u) ||                                         /* Chk for invalid sized mem req.                       */
+        (size >= LIB_MEM_TLSF_SIZE_MAX)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    size_blk = MATH_ROUND_INC_UP_PWR2(size, LIB_MEM_TLSF_ALIGN);
+    size_blk = DEF_MAX(size_blk, LIB_MEM_TLSF_BLK_SIZE_MIN);
+
+    LIB_MEM_TLSF_LOCK(p_tlsf);
+    p_blk = Mem_TlsfBlkFind(p_tlsf, size_blk);                  /* See Note #2.                                         */
+    if (p_blk == DEF_NULL) {
+        p_tlsf->Stat.AllocFailCtr++;
+        LIB_MEM_TLSF_UNLOCK(p_tlsf);
+
+       *p_err = LIB_MEM_ERR_HEAP_EMPTY;
+        return (DEF_NULL);
+    }
+
+    p_blk_next = LIB_MEM_TLSF_BLK_NEXT(p_blk);                  /* Mark blk as used.                                    */
+    DEF_BIT_CLR(p_blk_next->Size, (CPU_SIZE_T)LIB_MEM_TLSF_BLK_PREV_FREE);
+    DEF_BIT_CLR(p_blk->Size,      (CPU_SIZE_T)LIB_MEM_TLSF_BLK_FREE);
+
+    Mem_TlsfBlkTrim(p_tlsf, p_blk, size_blk);                   /* Return excess to heap.                               */
+
+    p_tlsf->Stat.SizeUsed    += LIB_MEM_TLSF_BLK_SIZE_GET(p_blk) + LIB_MEM_TLSF_BLK_OVERHEAD;
+    p_tlsf->Stat.SizeUsedMax  = DEF_MAX(p_tlsf->Stat.SizeUsedMax, p_tlsf->Stat.SizeUsed);
+    p_tlsf->Stat.BlkUsedCnt++;
+    LIB_MEM_TLSF_UNLOCK(p_tlsf);
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (LIB_MEM_TLSF_BLK_TO_PTR(p_blk));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TlsfRealloc()
+*
+* Description : Changes the size of a memory block allocated from a TLSF heap, moving it if needed.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*
+*               p_mem   Pointer to memory block, or DEF_NULL to allocate a new block.
+*
+*               size    New size of memory block, in bytes, or 0 to free the block.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                    Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                Heap data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE        Invalid memory block size specified.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR        Memory block address outside of heap.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL    Memory block is NOT allocated.
+*
+*                           ------------------RETURNED BY Mem_TlsfAlloc()-------------------
+*                           LIB_MEM_ERR_HEAP_EMPTY              No free block large enough in heap.
+*
+* Return(s)   : Pointer to resized memory block, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The block is resized in place when it shrinks or when the next block is free & large
+*                   enough. Otherwise, a new block is allocated, the contents are copied & the old block is
+*                   freed; the heap is NOT locked during the copy. On failure, the old block is left intact.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  *Mem_TlsfRealloc (MEM_TLSF    *p_tlsf,
+                        void        *p_mem,
+                        CPU_SIZE_T   size,
+                        LIB_ERR     *p_err)
+{
+    MEM_TLSF_BLK  *p_blk;
+    MEM_TLSF_BLK  *p_blk_next;
+    void          *p_mem_new;
+    CPU_SIZE_T     size_blk;
+    CPU_SIZE_T     size_cur;
+    LIB_ERR        err;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_tlsf == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (p_mem == DEF_NULL) {
+        return (Mem_TlsfAlloc(p_tlsf, size, p_err));
+    }
+
+    if (size < 1u) {
+        Mem_TlsfFree(p_tlsf, p_mem, p_err);
+        return (DEF_NULL);
+    }
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* Chk that blk lies in heap region.                    */
+    if ((((CPU_ADDR)p_mem) <  (p_tlsf->AddrStart + LIB_MEM_TLSF_BLK_OVERHEAD)) ||
+        (((CPU_ADDR)p_mem) >   p_tlsf->AddrEnd)                                 ||
+        (((CPU_ADDR)p_mem  &  (LIB_MEM_TLSF_ALIGN - 1u)) != 0u)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (size >= LIB_MEM_TLSF_SIZE_MAX) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+
+    size_blk = MATH_ROUND_INC_UP_PWR2(size, LIB_MEM_TLSF_ALIGN);
+    size_blk = DEF_MAX(size_blk, LIB_MEM_TLSF_BLK_SIZE_MIN);
+    p_blk    = LIB_MEM_TLSF_BLK_FROM_PTR(p_mem);
+
+    LIB_MEM_TLSF_LOCK(p_tlsf);
+    if (DEF_BIT_IS_SET(p_blk->Size, LIB_MEM_TLSF_BLK_FREE) == DEF_YES) {
+        LIB_MEM_TLSF_UNLOCK(p_tlsf);                            /* Blk is NOT alloc'd.                                  */
+
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return (DEF_NULL);
+    }
+
+    size_cur   = LIB_MEM_TLSF_BLK_SIZE_GET(p_blk);
+    p_blk_next = LIB_MEM_TLSF_BLK_NEXT(p_blk);
+    if ((size_blk > size_cur) &&                                /* If blk can't grow in place ...                       */
+        ((DEF_BIT_IS_CLR(p_blk_next->Size, LIB_MEM_TLSF_BLK_FREE) == DEF_YES) ||
+         (size_blk > size_cur + LIB_MEM_TLSF_BLK_SIZE_GET(p_blk_next) + LIB_MEM_TLSF_BLK_OVERHEAD))) {
+        LIB_MEM_TLSF_UNLOCK(p_tlsf);
+                                                                /* ... move blk (see Note #1).                          */
+        p_mem_new = Mem_TlsfAlloc(p_tlsf, size, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return (DEF_NULL);
+        }
+
+        Mem_Copy(p_mem_new, p_mem, size_cur);
+        Mem_TlsfFree(p_tlsf, p_mem, &err);
+        (void)err;
+
+        return (p_mem_new);
+    }
+
+    if (size_blk > size_cur) {                                  /* Grow blk over next free blk.                         */
+        p_blk      = Mem_TlsfBlkMergeNext(p_tlsf, p_blk);
+        p_blk_next = LIB_MEM_TLSF_BLK_NEXT(p_blk);
+        DEF_BIT_CLR(p_blk_next->Size, (CPU_SIZE_T)LIB_MEM_TLSF_BLK_PREV_FREE);
+    }
+
+    Mem_TlsfBlkTrim(p_tlsf, p_blk, size_blk);                   /* Return excess to heap.                               */
+
+    p_tlsf->Stat.SizeUsed    = (p_tlsf->Stat.SizeUsed - size_cur) + LIB_MEM_TLSF_BLK_SIZE_GET(p_blk);
+    p_tlsf->Stat.SizeUsedMax =  DEF_MAX(p_tlsf->Stat.SizeUsedMax, p_tlsf->Stat.SizeUsed);
+    LIB_MEM_TLSF_UNLOCK(p_tlsf);
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_mem);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_TlsfFree()
+*
+* Description : Frees a memory block allocated from a TLSF heap, merging it with its free neighbours.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*
+*               p_mem   Pointer to memory block.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                    'p_tlsf' or 'p_mem' pointer passed is NULL.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR            Memory block address outside of heap.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL    Memory block is NOT allocated.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               Mem_TlsfRealloc().
+*
+* Note(s)     : (1) A block freed twice is detected from its header & rejected.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TlsfFree (MEM_TLSF  *p_tlsf,
+                    void      *p_mem,
+                    LIB_ERR   *p_err)
+{
+    MEM_TLSF_BLK  *p_blk;
+    MEM_TLSF_BLK  *p_blk_next;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_tlsf == DEF_NULL) {                                   /* Chk for NULL heap data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (p_mem == DEF_NULL) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+                                                                /* Chk that blk lies in heap region.                    */
+    if ((((CPU_ADDR)p_mem) <  (p_tlsf->AddrStart + LIB_MEM_TLSF_BLK_OVERHEAD)) ||
+        (((CPU_ADDR)p_mem) >   p_tlsf->AddrEnd)                                 ||
+        (((CPU_ADDR)p_mem  &  (LIB_MEM_TLSF_ALIGN - 1u)) != 0u)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return;
+    }
+#endif
+
+    p_blk = LIB_MEM_TLSF_BLK_FROM_PTR(p_mem);
+
+    LIB_MEM_TLSF_LOCK(p_tlsf);
+    if (DEF_BIT_IS_SET(p_blk->Size, LIB_MEM_TLSF_BLK_FREE) == DEF_YES) {
+        LIB_MEM_TLSF_UNLOCK(p_tlsf);                            /* Blk is NOT alloc'd (see Note #1).                    */
+
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return;
+    }
+
+    p_tlsf->Stat.SizeUsed -= LIB_MEM_TLSF_BLK_SIZE_GET(p_blk) + LIB_MEM_TLSF_BLK_OVERHEAD;
+    p_tlsf->Stat.BlkUsedCnt--;
+
+    p_blk_next              = LIB_MEM_TLSF_BLK_NEXT(p_blk);     /* Mark blk as free.                                    */
+    p_blk_next->PrevPhysPtr = p_blk;
+    DEF_BIT_SET(p_blk_next->Size, (CPU_SIZE_T)LIB_MEM_TLSF_BLK_PREV_FREE);
+    DEF_BIT_SET(p_blk->Size,      (CPU_SIZE_T)LIB_MEM_TLSF_BLK_FREE);
+
+    p_blk = Mem_TlsfBlkMergePrev(p_tlsf, p_blk);                /* Merge with free neighbours.                          */
+    p_blk = Mem_TlsfBlkMergeNext(p_tlsf, p_blk);
+    Mem_TlsfBlkInsert(p_tlsf, p_blk);
+    LIB_MEM_TLSF_UNLOCK(p_tlsf);
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TlsfStatGet()
+*
+* Description : Gets the usage statistics of a TLSF heap.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*
+*               p_stat  Pointer to variable that will receive the heap statistics.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR    'p_tlsf' or 'p_stat' pointer passed is NULL.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void  Mem_TlsfStatGet (MEM_TLSF       *p_tlsf,
+                       MEM_TLSF_STAT  *p_stat,
+                       LIB_ERR        *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_tlsf == DEF_NULL) ||                                 /* Chk for NULL heap data & stat ptrs.                  */
+        (p_stat == DEF_NULL)) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    LIB_MEM_TLSF_LOCK(p_tlsf);
+   *p_stat = p_tlsf->Stat;
+    LIB_MEM_TLSF_UNLOCK(p_tlsf);
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_OutputUsage()
+*
+* Description : Outputs memory usage report through 'out_fnct'.
+*
+* Argument(s) : out_fnct        Pointer to output function.
+*
+*               print_details   DEF_YES, if the size of each allocation should be printed.
+*                               DEF_NO,  otherwise.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            'out_fnct' pointer passed is NULL.
+*
+*                                   ---------------------RETURNED BY Mem_SegRemSizeGet()--------------------
+*                                   LIB_MEM_ERR_NULL_PTR            Segment data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory alignment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
+                      LIB_ERR   *p_err)
+{
+    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
+    MEM_SEG   *p_seg;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (out_fnct == DEF_NULL) {                                 /* Chk for NULL out fnct ptr.                           */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    out_fnct("---------------- Memory allocation info ----------------\r\n");
+    out_fnct("| Type    | Size       | Free size  | Name\r\n");
+    out_fnct("|---------|------------|------------|-------------------\r\n");
+
+    CPU_CRITICAL_ENTER();
+    p_seg = Mem_SegHeadPtr;
+    while (p_seg != DEF_NULL) {
+        CPU_SIZE_T       rem_size;
+        MEM_SEG_INFO     seg_info;
+        MEM_ALLOC_INFO  *p_alloc;
+
+
+        rem_size = Mem_SegRemSizeGet(p_seg, 1u, &seg_info, p_err);
+        if (*p_err != LIB_MEM_ERR_NONE) {
+            return;
+        }
+
+        out_fnct("| Section | ");
+
+        (void)Str_FmtNbr_Int32U(seg_info.TotalSize,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct(" | ");
+
+        (void)Str_FmtNbr_Int32U(rem_size,
+                                10u,
+                                DEF_NBR_BASE_DEC,
+                                ' ',
+                                DEF_NO,
+                                DEF_YES,
+                               &str[0u]);
+
+        out_fnct(str);
+        out_fnct(" | ");
+        out_fnct((p_seg->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_seg->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct("\r\n");
+
+        p_alloc = p_seg->AllocInfoHeadPtr;
+        while (p_alloc != DEF_NULL) {
+            out_fnct("| -> Obj  | ");
+
+            (void)Str_FmtNbr_Int32U(p_alloc->Size,
+                                    10u,
+                                    DEF_NBR_BASE_DEC,
+                                    ' ',
+                                    DEF_NO,
+                                    DEF_YES,
+                                   &str[0u]);
+
+            out_fnct(str);
+            out_fnct(" |            | ");
+
+            out_fnct((p_alloc->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_alloc->NamePtr : (CPU_CHAR *)"Unknown");
+            out_fnct("\r\n");
+
+            p_alloc = p_alloc->NextPtr;
+        }
+
+        p_seg = p_seg->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       Mem_SegCreateCritical()
+*
+* Description : Creates a new memory segment to be used for runtime memory allocation or dynamic pools.
+*
+* Argument(s) : p_name          Pointer to segment name.
+*
+*               p_seg           Pointer to segment data. Must be allocated by caller.
+*               -----           Argument validated by caller.
+*
+*               seg_base_addr   Segment's first byte address.
+*
+*               padding_align   Padding alignment, in bytes, that will be added to any allocated buffer
+*                               from this memory segment. MUST be a power of 2.
+*                               LIB_MEM_PADDING_ALIGN_NONE means no padding.
+*               -------------   Argument validated by caller.
+*
+*               size            Total size of segment, in bytes.
+*               ----            Argument validated by caller.
+*
+* Return(s)   : Pointer to segment data, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_PoolCreate(),
+*               Mem_SegCreate().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
                                            MEM_SEG     *p_seg,
                                            CPU_ADDR     seg_base_addr,
                                            CPU_SIZE_T   padding_align,
@@ -2335,6 +3297,9 @@ static  void  Mem_SegCreateCritical(const  CPU_CHAR    *p_name,
     p_seg->AddrNext         =  seg_base_addr;
     p_seg->NextPtr          =  Mem_SegHeadPtr;
     p_seg->PaddingAlign     =  padding_align;
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+    p_seg->FreeHeadPtr      =  DEF_NULL;
+#endif
 
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     p_seg->NamePtr          = p_name;
@@ -2449,7 +3414,8 @@ static  MEM_SEG  *Mem_SegOverlapChkCritical (CPU_ADDR     seg_base_addr,
 *               Mem_PoolCreate(),
 *               Mem_SegAlloc(),
 *               Mem_SegAllocExt(),
-*               Mem_SegAllocHW().
+*               Mem_SegAllocHW(),
+*               Mem_TlsfCreate().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -2585,6 +3551,219 @@ static  void  *Mem_SegAllocExtCritical (MEM_SEG     *p_seg,
 }
 
 
+/*
+*********************************************************************************************************
+*                                     Mem_SegChunkAllocCritical()
+*
+* Description : Allocates a dynamic memory pool chunk from specified segment, reusing a free region of the
+*               segment if possible.
+*
+* Argument(s) : p_seg           Pointer to segment from which to allocate memory.
+*
+*               size            Size of chunk to allocate, in bytes.
+*
+*               align           Required alignment of chunk, in bytes. MUST be a power of 2 & at least
+*                               'sizeof(CPU_ALIGN)'.
+*
+*               p_seg_addr      Pointer to variable that will receive the start address of the segment
+*                               region occupied by the chunk.
+*
+*               p_seg_size      Pointer to variable that will receive the size of the segment region
+*                               occupied by the chunk, in bytes.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE        Operation was successful.
+*
+*                                   ------------------RETURNED BY Mem_SegAllocExtCritical()------------------
+*                                   LIB_MEM_ERR_SEG_OVF     Allocation would overflow memory segment.
+*
+* Return(s)   : Pointer to allocated chunk, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_DynPoolChunkAdd().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*
+*               (2) The chunk is carved at the end of the first free region large enough, so the remainder
+*                   keeps its header & its place in the address-ordered list. A remainder too small to hold
+*                   a region header is handed out with the chunk & reported in the occupied region, so that
+*                   it is given back when the chunk is freed.
+*
+*               (3) The occupied region of a chunk allocated from the segment top includes the alignment
+*                   gap before the chunk, so that freeing it restores the segment's next free address.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+static  void  *Mem_SegChunkAllocCritical (MEM_SEG     *p_seg,
+                                          CPU_SIZE_T   size,
+                                          CPU_SIZE_T   align,
+                                          CPU_ADDR    *p_seg_addr,
+                                          CPU_SIZE_T  *p_seg_size,
+                                          LIB_ERR     *p_err)
+{
+    MEM_SEG_FREE  *p_free;
+    MEM_SEG_FREE  *p_free_prev;
+    CPU_ADDR       free_addr;
+    CPU_ADDR       free_addr_end;
+    CPU_ADDR       blk_addr;
+    CPU_ADDR       addr_next;
+    void          *p_blk;
+
+
+                                                                /* ------------ ALLOC FROM A FREE REGION -------------- */
+    p_free_prev = DEF_NULL;
+    p_free      = p_seg->FreeHeadPtr;
+    while (p_free != DEF_NULL) {
+        if (p_free->Size >= size) {
+            free_addr     = (CPU_ADDR)p_free;
+            free_addr_end =  free_addr + p_free->Size;
+            blk_addr      = (free_addr_end - size) & ~((CPU_ADDR)align - 1u);
+            if (blk_addr >= free_addr) {                        /* See Note #2.                                         */
+                if ((blk_addr - free_addr) < sizeof(MEM_SEG_FREE)) {
+                    if (p_free_prev == DEF_NULL) {
+                        p_seg->FreeHeadPtr   = p_free->NextPtr;
+                    } else {
+                        p_free_prev->NextPtr = p_free->NextPtr;
+                    }
+                   *p_seg_addr = free_addr;
+                } else {
+                    p_free->Size = blk_addr - free_addr;
+                   *p_seg_addr   = blk_addr;
+                }
+               *p_seg_size = free_addr_end - *p_seg_addr;
+               *p_err      = LIB_MEM_ERR_NONE;
+
+                return ((void *)blk_addr);
+            }
+        }
+
+        p_free_prev = p_free;
+        p_free      = p_free->NextPtr;
+    }
+
+                                                                /* ---------------- ALLOC FROM SEG TOP ---------------- */
+    addr_next = p_seg->AddrNext;
+    p_blk     = Mem_SegAllocExtCritical(p_seg,
+                                        size,
+                                        align,
+                                        LIB_MEM_PADDING_ALIGN_NONE,
+                                        DEF_NULL,
+                                        p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+   *p_seg_addr = addr_next;                                     /* See Note #3.                                         */
+   *p_seg_size = p_seg->AddrNext - addr_next;
+
+    return (p_blk);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_SegChunkFreeCritical()
+*
+* Description : Gives a region occupied by a dynamic memory pool chunk back to its segment.
+*
+* Argument(s) : p_seg           Pointer to segment the region was allocated from.
+*
+*               seg_addr        Start address of the region, as returned by Mem_SegChunkAllocCritical().
+*
+*               seg_size        Size of the region, in bytes, as returned by Mem_SegChunkAllocCritical().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolTrim().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*
+*               (2) A region that ends at the segment's next free address lowers that address, along with
+*                   the last free region if it then ends there too. Any other region is inserted in the
+*                   address-ordered free region list & merged with its neighbours (see 'lib_mem.h  MEMORY
+*                   SEGMENTS DATA TYPES  Note #1').
+*
+*               (3) The region start is aligned on 'CPU_ALIGN' to hold the region header; up to
+*                   'sizeof(CPU_ALIGN) - 1' octets left before it by an unaligned allocation are lost.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+static  void  Mem_SegChunkFreeCritical (MEM_SEG     *p_seg,
+                                        CPU_ADDR     seg_addr,
+                                        CPU_SIZE_T   seg_size)
+{
+    MEM_SEG_FREE  *p_free;
+    MEM_SEG_FREE  *p_free_prev;
+    MEM_SEG_FREE  *p_free_new;
+    CPU_ADDR       addr_align;
+
+
+                                                                /* ----------------- FREE TO SEG TOP ------------------ */
+    if ((seg_addr + seg_size) == p_seg->AddrNext) {             /* See Note #2.                                         */
+        p_seg->AddrNext = seg_addr;
+
+        p_free_prev = DEF_NULL;
+        p_free      = p_seg->FreeHeadPtr;
+        while ((p_free          != DEF_NULL) &&
+               (p_free->NextPtr != DEF_NULL)) {
+            p_free_prev = p_free;
+            p_free      = p_free->NextPtr;
+        }
+
+        if ((p_free != DEF_NULL) &&
+           (((CPU_ADDR)p_free + p_free->Size) == p_seg->AddrNext)) {
+            p_seg->AddrNext = (CPU_ADDR)p_free;
+            if (p_free_prev == DEF_NULL) {
+                p_seg->FreeHeadPtr   = DEF_NULL;
+            } else {
+                p_free_prev->NextPtr = DEF_NULL;
+            }
+        }
+        return;
+    }
+
+                                                                /* --------------- INSERT FREE REGION ----------------- */
+    addr_align = MATH_ROUND_INC_UP_PWR2(seg_addr, sizeof(CPU_ALIGN));
+    seg_size  -= addr_align - seg_addr;                         /* See Note #3.                                         */
+    seg_addr   = addr_align;
+
+    p_free_prev = DEF_NULL;
+    p_free      = p_seg->FreeHeadPtr;
+    while ((p_free != DEF_NULL) &&
+           ((CPU_ADDR)p_free < seg_addr)) {
+        p_free_prev = p_free;
+        p_free      = p_free->NextPtr;
+    }
+
+    if ((p_free != DEF_NULL) &&                                 /* Merge with next region, if adjacent.                 */
+        ((seg_addr + seg_size) == (CPU_ADDR)p_free)) {
+        seg_size += p_free->Size;
+        p_free    = p_free->NextPtr;
+    }
+
+    if ((p_free_prev != DEF_NULL) &&                            /* Merge with prev region, if adjacent ...              */
+        (((CPU_ADDR)p_free_prev + p_free_prev->Size) == seg_addr)) {
+        p_free_prev->Size   += seg_size;
+        p_free_prev->NextPtr = p_free;
+    } else {                                                    /* ... else insert new region.                          */
+        p_free_new          = (MEM_SEG_FREE *)seg_addr;
+        p_free_new->NextPtr =  p_free;
+        p_free_new->Size    =  seg_size;
+        if (p_free_prev == DEF_NULL) {
+            p_seg->FreeHeadPtr   = p_free_new;
+        } else {
+            p_free_prev->NextPtr = p_free_new;
+        }
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     Mem_SegAllocTrackCritical()
@@ -2649,8 +3828,50 @@ static  void  Mem_SegAllocTrackCritical (const  CPU_CHAR    *p_name,
     p_alloc->NamePtr = p_name;                                  /* Populate alloc info.                                 */
     p_alloc->Size    = size;
 
-    p_alloc->NextPtr        = p_seg->AllocInfoHeadPtr;          /* Prepend new item in list.                            */
-    p_seg->AllocInfoHeadPtr = p_alloc;
+    p_alloc->NextPtr        = p_seg->AllocInfoHeadPtr;          /* Prepend new item in list.                            */
+    p_seg->AllocInfoHeadPtr = p_alloc;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_SegFreeTrackCritical()
+*
+* Description : Removes the 'size' of a freed allocation from the 'p_name' allocation tracking entry.
+*
+* Argument(s) : p_name  Pointer to the name of the object.
+*
+*               p_seg   Pointer to segment data.
+*
+*               size    Freed size, in bytes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_DynPoolTrim().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*********************************************************************************************************
+*/
+
+#if ((LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_DBG_INFO_EN      == DEF_ENABLED))
+static  void  Mem_SegFreeTrackCritical (const  CPU_CHAR    *p_name,
+                                               MEM_SEG     *p_seg,
+                                               CPU_SIZE_T   size)
+{
+    MEM_ALLOC_INFO  *p_alloc;
+
+
+    p_alloc = p_seg->AllocInfoHeadPtr;
+    while (p_alloc != DEF_NULL) {
+        if (p_alloc->NamePtr == p_name) {
+            p_alloc->Size -= DEF_MIN(size, p_alloc->Size);
+            return;
+        }
+
+        p_alloc = p_alloc->NextPtr;
+    }
 }
 #endif
 
@@ -2774,6 +3995,9 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
     p_pool->BlkPaddingAlign =   blk_padding_align;
     p_pool->BlkQtyMax       =   blk_qty_max;
     p_pool->BlkAllocCnt     =   0u;
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+    p_pool->ChunkHeadPtr    =   DEF_NULL;
+#endif
 
     if (blk_qty_init != 0u) {                                   /* Init free list.                                      */
         CPU_SIZE_T  i;
@@ -2797,6 +4021,542 @@ static  void  Mem_DynPoolCreateInternal (const  CPU_CHAR      *p_name,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolChunkAdd()
+*
+* Description : Grows a dynamic memory pool by a chunk of blocks.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*               ------  Argument validated by caller.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE            Operation was successful.
+*
+*                           --------------RETURNED BY Mem_SegChunkAllocCritical()---------------
+*                           LIB_MEM_ERR_SEG_OVF         Allocation would overflow memory segment.
+*
+*                           --------------RETURNED BY Mem_SegAllocTrackCritical()---------------
+*                           LIB_MEM_ERR_HEAP_EMPTY      No more memory available on heap.
+*
+* Return(s)   : Pointer to first block of the new chunk, if successful.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_DynPoolBlkGet().
+*
+* Note(s)     : (1) A chunk never holds more blocks than the pool can still allocate. If the segment can
+*                   NOT hold a full chunk, a chunk of a single block is tried instead.
+*
+*               (2) The first block is returned to the caller; the others are pushed on the free list.
+*
+*               (3) As in Mem_SegAllocExtCritical(), each block is aligned on the largest of the block
+*                   alignment & the padding alignment, & is padded up to the padding alignment. Blocks of
+*                   a chunk thus never share a padding unit (e.g. a cache line) with each other or with
+*                   the chunk header.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+static  void  *Mem_DynPoolChunkAdd (MEM_DYN_POOL  *p_pool,
+                                    LIB_ERR       *p_err)
+{
+    MEM_DYN_POOL_CHUNK  *p_chunk;
+    CPU_INT08U          *p_blk;
+    CPU_INT08U          *p_blk_first;
+    CPU_INT08U          *p_blk_last;
+    CPU_SIZE_T           blk_align;
+    CPU_SIZE_T           blk_stride;
+    CPU_SIZE_T           blk_qty;
+    CPU_SIZE_T           chunk_align;
+    CPU_SIZE_T           hdr_size;
+    CPU_ADDR             seg_addr;
+    CPU_SIZE_T           seg_size;
+    CPU_SR_ALLOC();
+
+
+                                                                /* See Note #3.                                         */
+    blk_align   = DEF_MAX(p_pool->BlkAlign, p_pool->BlkPaddingAlign);
+    blk_stride  = MATH_ROUND_INC_UP_PWR2(DEF_MAX(p_pool->BlkSize, sizeof(void *)), blk_align);
+    chunk_align = DEF_MAX(blk_align, sizeof(CPU_ALIGN));
+    hdr_size    = MATH_ROUND_INC_UP_PWR2(sizeof(MEM_DYN_POOL_CHUNK), chunk_align);
+
+    blk_qty     = LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY;           /* See Note #1.                                         */
+    if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {       /* Caller's blk is already cnt'd in 'BlkAllocCnt'.      */
+        blk_qty = DEF_MIN(blk_qty, (p_pool->BlkQtyMax - p_pool->BlkAllocCnt) + 1u);
+    }
+
+                                                                /* ------------------ ALLOC CHUNK --------------------- */
+    CPU_CRITICAL_ENTER();
+    p_chunk = (MEM_DYN_POOL_CHUNK *)Mem_SegChunkAllocCritical(p_pool->PoolSegPtr,
+                                                              hdr_size + (blk_stride * blk_qty),
+                                                              chunk_align,
+                                                             &seg_addr,
+                                                             &seg_size,
+                                                              p_err);
+    if ((*p_err  == LIB_MEM_ERR_SEG_OVF) &&
+        (blk_qty >  1u)) {
+        blk_qty = 1u;
+        p_chunk = (MEM_DYN_POOL_CHUNK *)Mem_SegChunkAllocCritical(p_pool->PoolSegPtr,
+                                                                  hdr_size + blk_stride,
+                                                                  chunk_align,
+                                                                 &seg_addr,
+                                                                 &seg_size,
+                                                                  p_err);
+    }
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_NULL);
+    }
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)                    /* Track alloc if req'd.                                */
+    Mem_SegAllocTrackCritical(p_pool->NamePtr,
+                              p_pool->PoolSegPtr,
+                              seg_size,
+                              p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        Mem_SegChunkFreeCritical(p_pool->PoolSegPtr, seg_addr, seg_size);
+        CPU_CRITICAL_EXIT();
+        return (DEF_NULL);
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+                                                                /* ------------------- INIT CHUNK --------------------- */
+    p_chunk->SegAddr    = seg_addr;
+    p_chunk->SegSize    = seg_size;
+    p_chunk->BlkQty     = blk_qty;
+    p_chunk->BlkFreeCnt = 0u;
+
+    p_blk_first = (CPU_INT08U *)p_chunk + hdr_size;
+    p_blk_last  =  p_blk_first + (blk_stride * (blk_qty - 1u));
+    for (p_blk = p_blk_first + blk_stride; p_blk < p_blk_last; p_blk += blk_stride) {
+       *((void **)p_blk) = p_blk + blk_stride;                  /* Link blks following the first one (see Note #2).     */
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_chunk->NextPtr     = p_pool->ChunkHeadPtr;
+    p_pool->ChunkHeadPtr = p_chunk;
+    if (blk_qty > 1u) {
+       *((void **)p_blk_last) = p_pool->BlkFreePtr;
+        p_pool->BlkFreePtr    = p_blk_first + blk_stride;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk_first);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_DynPoolChunkFind()
+*
+* Description : Finds the chunk holding a dynamic memory pool block.
+*
+* Argument(s) : p_chunk     Pointer to first chunk to search.
+*
+*               p_blk       Pointer to memory block.
+*
+*               hdr_size    Size of chunk header, including alignment, in bytes.
+*
+*               blk_stride  Distance between two blocks of a chunk, in bytes.
+*
+* Return(s)   : Pointer to chunk holding the block, if any.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_DynPoolTrim().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+static  MEM_DYN_POOL_CHUNK  *Mem_DynPoolChunkFind (MEM_DYN_POOL_CHUNK  *p_chunk,
+                                                   void                *p_blk,
+                                                   CPU_SIZE_T           hdr_size,
+                                                   CPU_SIZE_T           blk_stride)
+{
+    CPU_ADDR  blk_addr;
+    CPU_ADDR  blks_addr_start;
+    CPU_ADDR  blks_addr_end;
+
+
+    blk_addr = (CPU_ADDR)p_blk;
+    while (p_chunk != DEF_NULL) {
+        blks_addr_start = (CPU_ADDR)p_chunk + hdr_size;
+        blks_addr_end   =  blks_addr_start  + (blk_stride * p_chunk->BlkQty);
+        if ((blk_addr >= blks_addr_start) &&
+            (blk_addr <  blks_addr_end)) {
+            return (p_chunk);
+        }
+
+        p_chunk = p_chunk->NextPtr;
+    }
+
+    return (DEF_NULL);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            Mem_TlsfMap()
+*
+* Description : Maps a TLSF block size to its free list.
+*
+* Argument(s) : size    Size of block data, in bytes.
+*
+*               p_fl    Pointer to variable that will receive the first-level class index.
+*
+*               p_sl    Pointer to variable that will receive the second-level list index.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TlsfBlkFind(),
+*               Mem_TlsfBlkInsert(),
+*               Mem_TlsfBlkRemove().
+*
+* Note(s)     : (1) See 'lib_mem.h  TLSF HEAP DATA TYPES  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void  Mem_TlsfMap (CPU_SIZE_T   size,
+                           CPU_SIZE_T  *p_fl,
+                           CPU_SIZE_T  *p_sl)
+{
+    CPU_SIZE_T  fl;
+    CPU_SIZE_T  sl;
+
+
+    if (size < LIB_MEM_TLSF_SIZE_SMALL) {                       /* Small blks share FL class 0, split linearly.         */
+        fl = 0u;
+        sl = size >> LIB_MEM_TLSF_ALIGN_LOG2;
+    } else {                                                    /* FL is the pos of the size's msb ...                  */
+        fl = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)size);
+                                                                /* ... & SL the value of the next SL_LOG2 bits.         */
+        sl = (size >> (fl - LIB_MEM_CFG_TLSF_SL_LOG2)) - LIB_MEM_TLSF_SL_CNT;
+        fl = (fl - LIB_MEM_TLSF_FL_SHIFT) + 1u;
+    }
+
+   *p_fl = fl;
+   *p_sl = sl;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TlsfBlkFind()
+*
+* Description : Finds a free TLSF block large enough for a request & removes it from its free list.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               size    Size of block data, in bytes. MUST be a multiple of LIB_MEM_TLSF_ALIGN.
+*
+* Return(s)   : Pointer to free block, if any.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Mem_TlsfAlloc().
+*
+* Note(s)     : (1) The size is rounded up to the next list boundary so that the first block of any list
+*                   found is large enough (see 'lib_mem.h  TLSF HEAP DATA TYPES  Note #1b').
+*
+*               (2) The heap MUST be locked by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  MEM_TLSF_BLK  *Mem_TlsfBlkFind (MEM_TLSF    *p_tlsf,
+                                        CPU_SIZE_T   size)
+{
+    MEM_TLSF_BLK  *p_blk;
+    CPU_DATA       bitmap;
+    CPU_SIZE_T     fl;
+    CPU_SIZE_T     sl;
+
+
+    if (size >= LIB_MEM_TLSF_SIZE_SMALL) {                      /* Round size up to next list boundary (see Note #1).   */
+        fl    = (DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)size);
+        size += ((CPU_SIZE_T)1u << (fl - LIB_MEM_CFG_TLSF_SL_LOG2)) - 1u;
+    }
+
+    Mem_TlsfMap(size, &fl, &sl);
+    if (fl >= LIB_MEM_TLSF_FL_CNT) {
+        return (DEF_NULL);
+    }
+                                                                /* Search lists of same FL class ...                    */
+    bitmap = p_tlsf->SL_BitmapTbl[fl] & (DEF_INT_CPU_U_MAX_VAL << sl);
+    if (bitmap == 0u) {                                         /* ... then first list of next non-empty FL class.      */
+        bitmap = p_tlsf->FL_Bitmap & (DEF_INT_CPU_U_MAX_VAL << (fl + 1u));
+        if (bitmap == 0u) {
+            return (DEF_NULL);
+        }
+
+        fl     = CPU_CntTrailZeros(bitmap);
+        bitmap = p_tlsf->SL_BitmapTbl[fl];
+    }
+    sl    = CPU_CntTrailZeros(bitmap);
+    p_blk = p_tlsf->BlkFreeTbl[fl][sl];
+
+    Mem_TlsfBlkRemove(p_tlsf, p_blk);
+
+    return (p_blk);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_TlsfBlkInsert()
+*
+* Description : Inserts a free TLSF block at the head of its free list.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to free block.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TlsfBlkTrim(),
+*               Mem_TlsfCreate(),
+*               Mem_TlsfFree().
+*
+* Note(s)     : (1) The heap MUST be locked by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void  Mem_TlsfBlkInsert (MEM_TLSF      *p_tlsf,
+                                 MEM_TLSF_BLK  *p_blk)
+{
+    MEM_TLSF_BLK  *p_blk_head;
+    CPU_SIZE_T     fl;
+    CPU_SIZE_T     sl;
+
+
+    Mem_TlsfMap(LIB_MEM_TLSF_BLK_SIZE_GET(p_blk), &fl, &sl);
+
+    p_blk_head               =  p_tlsf->BlkFreeTbl[fl][sl];
+    p_blk->NextFreePtr       =  p_blk_head;
+    p_blk->PrevFreePtr       = &p_tlsf->BlkNull;
+    p_blk_head->PrevFreePtr  =  p_blk;
+    p_tlsf->BlkFreeTbl[fl][sl] = p_blk;
+
+    DEF_BIT_SET(p_tlsf->FL_Bitmap,        (CPU_DATA)DEF_BIT(fl));
+    DEF_BIT_SET(p_tlsf->SL_BitmapTbl[fl], (CPU_DATA)DEF_BIT(sl));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_TlsfBlkRemove()
+*
+* Description : Removes a free TLSF block from its free list.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to free block.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TlsfBlkFind(),
+*               Mem_TlsfBlkMergeNext(),
+*               Mem_TlsfBlkMergePrev().
+*
+* Note(s)     : (1) The heap MUST be locked by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void  Mem_TlsfBlkRemove (MEM_TLSF      *p_tlsf,
+                                 MEM_TLSF_BLK  *p_blk)
+{
+    MEM_TLSF_BLK  *p_blk_next;
+    MEM_TLSF_BLK  *p_blk_prev;
+    CPU_SIZE_T     fl;
+    CPU_SIZE_T     sl;
+
+
+    Mem_TlsfMap(LIB_MEM_TLSF_BLK_SIZE_GET(p_blk), &fl, &sl);
+
+    p_blk_next              = p_blk->NextFreePtr;               /* Null blk absorbs updates at list ends.               */
+    p_blk_prev              = p_blk->PrevFreePtr;
+    p_blk_next->PrevFreePtr = p_blk_prev;
+    p_blk_prev->NextFreePtr = p_blk_next;
+
+    if (p_tlsf->BlkFreeTbl[fl][sl] == p_blk) {                  /* If blk was list head ...                             */
+        p_tlsf->BlkFreeTbl[fl][sl] = p_blk_next;
+        if (p_blk_next == &p_tlsf->BlkNull) {                   /* ... & list is now empty, clr its bitmap bits.        */
+            DEF_BIT_CLR(p_tlsf->SL_BitmapTbl[fl], (CPU_DATA)DEF_BIT(sl));
+            if (p_tlsf->SL_BitmapTbl[fl] == 0u) {
+                DEF_BIT_CLR(p_tlsf->FL_Bitmap, (CPU_DATA)DEF_BIT(fl));
+            }
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_TlsfBlkMergePrev()
+*
+* Description : Merges a free TLSF block with the previous block, if free.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to free block, NOT in any free list.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : Pointer to merged block.
+*
+* Caller(s)   : Mem_TlsfFree().
+*
+* Note(s)     : (1) The heap MUST be locked by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  MEM_TLSF_BLK  *Mem_TlsfBlkMergePrev (MEM_TLSF      *p_tlsf,
+                                             MEM_TLSF_BLK  *p_blk)
+{
+    MEM_TLSF_BLK  *p_blk_prev;
+    MEM_TLSF_BLK  *p_blk_next;
+
+
+    if (DEF_BIT_IS_CLR(p_blk->Size, LIB_MEM_TLSF_BLK_PREV_FREE) == DEF_YES) {
+        return (p_blk);
+    }
+
+    p_blk_prev = p_blk->PrevPhysPtr;
+    Mem_TlsfBlkRemove(p_tlsf, p_blk_prev);
+                                                                /* Prev blk absorbs blk & its hdr.                      */
+    p_blk_prev->Size        += LIB_MEM_TLSF_BLK_SIZE_GET(p_blk) + LIB_MEM_TLSF_BLK_OVERHEAD;
+    p_blk_next               = LIB_MEM_TLSF_BLK_NEXT(p_blk_prev);
+    p_blk_next->PrevPhysPtr  = p_blk_prev;
+
+    return (p_blk_prev);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_TlsfBlkMergeNext()
+*
+* Description : Merges a TLSF block with the next block, if free.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to block, NOT in any free list.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : Pointer to merged block.
+*
+* Caller(s)   : Mem_TlsfBlkTrim(),
+*               Mem_TlsfFree(),
+*               Mem_TlsfRealloc().
+*
+* Note(s)     : (1) The block keeps its own state bits. When an allocated block grows over the next block,
+*                   the caller MUST clear the 'previous free' bit of the block that follows.
+*
+*               (2) The heap MUST be locked by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  MEM_TLSF_BLK  *Mem_TlsfBlkMergeNext (MEM_TLSF      *p_tlsf,
+                                             MEM_TLSF_BLK  *p_blk)
+{
+    MEM_TLSF_BLK  *p_blk_next;
+
+
+    p_blk_next = LIB_MEM_TLSF_BLK_NEXT(p_blk);
+    if (DEF_BIT_IS_CLR(p_blk_next->Size, LIB_MEM_TLSF_BLK_FREE) == DEF_YES) {
+        return (p_blk);
+    }
+
+    Mem_TlsfBlkRemove(p_tlsf, p_blk_next);
+                                                                /* Blk absorbs next blk & its hdr (see Note #1).        */
+    p_blk->Size             += LIB_MEM_TLSF_BLK_SIZE_GET(p_blk_next) + LIB_MEM_TLSF_BLK_OVERHEAD;
+    p_blk_next               = LIB_MEM_TLSF_BLK_NEXT(p_blk);
+    p_blk_next->PrevPhysPtr  = p_blk;
+
+    return (p_blk);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_TlsfBlkTrim()
+*
+* Description : Splits the excess off an allocated TLSF block & returns it to the heap.
+*
+* Argument(s) : p_tlsf  Pointer to heap data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to allocated block.
+*               -----   Argument validated by caller.
+*
+*               size    Size of block data to keep, in bytes. MUST be a multiple of LIB_MEM_TLSF_ALIGN.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_TlsfAlloc(),
+*               Mem_TlsfRealloc().
+*
+* Note(s)     : (1) The block is only split if the excess can hold a free block.
+*
+*               (2) The heap MUST be locked by the caller.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+static  void  Mem_TlsfBlkTrim (MEM_TLSF      *p_tlsf,
+                               MEM_TLSF_BLK  *p_blk,
+                               CPU_SIZE_T     size)
+{
+    MEM_TLSF_BLK  *p_blk_rem;
+    MEM_TLSF_BLK  *p_blk_next;
+    CPU_SIZE_T     size_blk;
+
+
+    size_blk = LIB_MEM_TLSF_BLK_SIZE_GET(p_blk);
+    if (size_blk < size + sizeof(MEM_TLSF_BLK)) {               /* See Note #1.                                         */
+        return;
+    }
+                                                                /* Split remainder blk after kept data.                 */
+    p_blk_rem       = (MEM_TLSF_BLK *)((CPU_INT08U *)LIB_MEM_TLSF_BLK_TO_PTR(p_blk) + size - LIB_MEM_TLSF_BLK_OVERHEAD);
+    p_blk_rem->Size = (size_blk - size - LIB_MEM_TLSF_BLK_OVERHEAD) | LIB_MEM_TLSF_BLK_FREE;
+    p_blk->Size     =  size | (p_blk->Size & LIB_MEM_TLSF_BLK_STATE_MASK);
+
+    p_blk_next              = LIB_MEM_TLSF_BLK_NEXT(p_blk_rem); /* Mark remainder as free.                              */
+    p_blk_next->PrevPhysPtr = p_blk_rem;
+    DEF_BIT_SET(p_blk_next->Size, (CPU_SIZE_T)LIB_MEM_TLSF_BLK_PREV_FREE);
+
+    p_blk_rem = Mem_TlsfBlkMergeNext(p_tlsf, p_blk_rem);
+    Mem_TlsfBlkInsert(p_tlsf, p_blk_rem);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      Mem_PoolBlkIsValidAddr()
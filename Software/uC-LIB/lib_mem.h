@@ -184,6 +184,82 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                              STATIC MEMORY POOL LOCK-FREE CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_POOL_LOCK_FREE_EN to enable/disable the lock-free free block list of
+*               static memory pools (see '(STATIC) MEMORY POOL DATA TYPES  Note #2').
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg lock-free static mem pool (see Note #1) :        */
+#ifndef  LIB_MEM_CFG_POOL_LOCK_FREE_EN
+#define  LIB_MEM_CFG_POOL_LOCK_FREE_EN  DEF_DISABLED
+                                                                /* DEF_DISABLED     Lock-free mem pool DISABLED         */
+                                                                /* DEF_ENABLED      Lock-free mem pool ENABLED          */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                DYNAMIC MEMORY POOL TRIM CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_DYN_POOL_TRIM_EN to enable/disable Mem_DynPoolTrim(). When ENABLED,
+*               dynamic memory pools grow by chunks of blocks that can be returned to their memory segment
+*               (see 'DYNAMIC MEMORY POOL DATA TYPE  Note #3').
+*
+*           (2) Configure LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY with the number of blocks allocated each time a
+*               dynamic memory pool grows.
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg dyn mem pool trim (see Note #1) :                */
+#ifndef  LIB_MEM_CFG_DYN_POOL_TRIM_EN
+#define  LIB_MEM_CFG_DYN_POOL_TRIM_EN   DEF_DISABLED
+                                                                /* DEF_DISABLED     Dyn mem pool trim DISABLED          */
+                                                                /* DEF_ENABLED      Dyn mem pool trim ENABLED           */
+#endif
+
+                                                                /* Cfg nbr of blks per chunk (see Note #2).             */
+#ifndef  LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY
+#define  LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY               8u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       TLSF HEAP CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_TLSF_EN to enable/disable two-level segregated fit (TLSF) heaps, which
+*               allocate & free variable-size blocks in constant time (see 'TLSF HEAP DATA TYPES').
+*
+*           (2) Configure LIB_MEM_CFG_TLSF_SL_LOG2 with the base-2 logarithm of the number of free lists that
+*               split each power-of-two size class. More lists lower fragmentation but enlarge MEM_TLSF.
+*
+*           (3) Configure LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 with the base-2 logarithm of the size limit of a TLSF
+*               heap & of its blocks, in octets.
+*********************************************************************************************************
+*/
+
+                                                                /* Cfg TLSF heaps (see Note #1) :                       */
+#ifndef  LIB_MEM_CFG_TLSF_EN
+#define  LIB_MEM_CFG_TLSF_EN            DEF_DISABLED
+                                                                /* DEF_DISABLED     TLSF heaps DISABLED                 */
+                                                                /* DEF_ENABLED      TLSF heaps ENABLED                  */
+#endif
+
+                                                                /* Cfg nbr of lists per size class (see Note #2).       */
+#ifndef  LIB_MEM_CFG_TLSF_SL_LOG2
+#define  LIB_MEM_CFG_TLSF_SL_LOG2                         4u
+#endif
+
+                                                                /* Cfg heap size limit (see Note #3).                   */
+#ifndef  LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2
+#define  LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2                  20u
+#endif
+
+
 /*
 *********************************************************************************************************
 *                          MEMORY ALLOCATION DEBUG INFORMATION CONFIGURATION
@@ -268,9 +344,23 @@ struct  mem_alloc_info  {                                       /* -------------
 /*
 *********************************************************************************************************
 *                                     MEMORY SEGMENTS DATA TYPES
+*
+* Note(s) : (1) When LIB_MEM_CFG_DYN_POOL_TRIM_EN is ENABLED, regions given back to a segment by
+*               Mem_DynPoolTrim() are kept in an address-ordered list of free regions. Adjacent regions are
+*               merged & a region that ends at the segment's next free address lowers that address instead.
+*               The header of each free region is stored in the region itself.
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+typedef  struct  mem_seg_free  MEM_SEG_FREE;                    /* ------------------ SEG FREE REGION ----------------- */
+
+struct  mem_seg_free {
+    MEM_SEG_FREE  *NextPtr;                                     /* Ptr to next free region, at a higher addr.           */
+    CPU_SIZE_T     Size;                                        /* Size of free region, in octets.                      */
+};
+#endif
+
 typedef  struct  mem_seg  MEM_SEG;                              /* --------------------- SEG DATA --------------------- */
 
 struct mem_seg {
@@ -282,6 +372,10 @@ struct mem_seg {
 
            CPU_SIZE_T       PaddingAlign;                       /* Padding alignment in byte.                           */
 
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+           MEM_SEG_FREE    *FreeHeadPtr;                        /* Ptr to first free region (see Note #1).              */
+#endif
+
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     const  CPU_CHAR        *NamePtr;                            /* Ptr to seg name.                                     */
            MEM_ALLOC_INFO  *AllocInfoHeadPtr;                   /* Ptr to head of alloc info struct list.               */
@@ -318,6 +412,32 @@ typedef  struct  mem_seg_info {                                 /* -------------
 *                    |        |<-------- (Next block to be freed.)
 *                    \--------/
 *
+*           (2) When LIB_MEM_CFG_POOL_LOCK_FREE_EN is ENABLED, free blocks are instead linked in a LIFO list
+*               that is updated with a compare-and-swap, without disabling interrupts :
+*
+*               (a) 'BlkLinkTbl' holds one link per block. The link of a free block is the index plus one of
+*                   the next free block (0 ends the list); the link of an allocated block is
+*                   LIB_MEM_POOL_LINK_USED, which lets Mem_PoolBlkFree() detect a double free in one step.
+*
+*               (b) 'BlkFreeHead' packs the index plus one of the first free block in its lower 16 bits and
+*                   a modification tag in its upper 16 bits. The tag is incremented by every update so that a
+*                   head popped & pushed back between a reader's load and its compare-and-swap (ABA) does
+*                   NOT match anymore.
+*
+*               (c) 'BlkFreeCtr' is incremented before a block is pushed & decremented after a block is
+*                   popped, so it can run ahead of the list but never wraps below zero.
+*
+*                   BlkFreeHead                  BlkLinkTbl
+*                   /------------\               /--------\
+*                   | Tag | Ix+1 |----------\    |  Used  |  Blk #0
+*                   \------------/          |    |--------|
+*                                           \--->|   4    |  Blk #1
+*                                                |--------|
+*                                                |  Used  |  Blk #2
+*                                                |--------|
+*                                                |   0    |  Blk #3  (end of list)
+*                                                \--------/
+*
 *********************************************************************************************************
 */
 
@@ -327,8 +447,14 @@ typedef  struct  mem_pool {
     void               *PoolAddrEnd;                            /* Ptr   to end   of mem seg for mem pool blks.         */
     MEM_POOL_BLK_QTY    BlkNbr;                                 /* Nbr   of mem pool   blks.                            */
     CPU_SIZE_T          BlkSize;                                /* Size  of mem pool   blks (in octets).                */
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U volatile *BlkLinkTbl;                            /* Tbl of next free blk links      (see Note #2a).      */
+    CPU_INT32U volatile  BlkFreeHead;                           /* Tagged ix of first free blk     (see Note #2b).      */
+    CPU_INT32U volatile  BlkFreeCtr;                            /* Nbr of free blks                (see Note #2c).      */
+#else
     void              **BlkFreeTbl;                             /* Tbl of free mem pool blks.                           */
     CPU_SIZE_T          BlkFreeTblIx;                           /* Ix of next free blk free tbl entry.                  */
+#endif
 } MEM_POOL;
 
 
@@ -352,9 +478,27 @@ typedef  struct  mem_pool {
 *                    |          |      |          |       |          |   |          |
 *                    \----------/      \----------/       \----------/   \----------/
 *
+*           (3) When LIB_MEM_CFG_DYN_POOL_TRIM_EN is ENABLED, a pool grows by chunks of
+*               LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY blocks. Each chunk starts with a header that is linked in
+*               the pool's chunk list & records the segment region the chunk occupies, so that a chunk whose
+*               blocks are all free can be returned to its segment. Blocks allocated at pool creation are
+*               NOT part of any chunk & are never returned.
+*
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+typedef  struct  mem_dyn_pool_chunk  MEM_DYN_POOL_CHUNK;        /* --------------- DYN MEM POOL CHUNK ----------------- */
+
+struct  mem_dyn_pool_chunk {
+    MEM_DYN_POOL_CHUNK  *NextPtr;                               /* Ptr to next chunk of pool.                           */
+    CPU_ADDR             SegAddr;                               /* Start addr of seg region occupied by chunk.          */
+    CPU_SIZE_T           SegSize;                               /* Size of seg region occupied by chunk, in octets.     */
+    CPU_SIZE_T           BlkQty;                                /* Nbr of blks in chunk.                                */
+    CPU_SIZE_T           BlkFreeCnt;                            /* Nbr of free blks in chunk, as cnt'd by trim.         */
+};
+#endif
+
 typedef  struct  mem_dyn_pool {                                 /* ---------------- DYN MEM POOL DATA ----------------- */
            MEM_SEG     *PoolSegPtr;                             /* Mem pool from which blks are alloc'd.                */
            CPU_SIZE_T   BlkSize;                                /* Size of pool blks, in octets.                        */
@@ -365,12 +509,122 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
            CPU_SIZE_T   BlkQtyMax;                              /* Max qty of blk in dyn mem pool. 0 = unlimited.       */
            CPU_SIZE_T   BlkAllocCnt;                            /* Cnt of alloc blk.                                    */
 
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+    MEM_DYN_POOL_CHUNK *ChunkHeadPtr;                           /* Ptr to first chunk of pool (see Note #3).            */
+#endif
+
 #if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
     const  CPU_CHAR    *NamePtr;                                /* Ptr to mem pool name.                                */
 #endif
 } MEM_DYN_POOL;
 
 
+/*
+*********************************************************************************************************
+*                                        TLSF HEAP DATA TYPES
+*
+* Note(s) : (1) A TLSF heap carves one region of a memory segment into variable-size blocks. Free blocks are
+*               kept in one list per size range. A block of size S belongs to first-level class
+*               FL = floor(log2(S)), split in 2^LIB_MEM_CFG_TLSF_SL_LOG2 equal second-level ranges; blocks
+*               smaller than LIB_MEM_TLSF_SIZE_SMALL share first-level class 0, which is split linearly.
+*
+*               (a) 'FL_Bitmap' flags the first-level classes holding any free block & 'SL_BitmapTbl' flags,
+*                   for each first-level class, its non-empty second-level lists. A fit is found with two
+*                   count-leading/trailing-zeros operations, whatever the number of free blocks.
+*
+*               (b) A request is rounded up to the next list boundary before the search, so that any block of
+*                   the list found is large enough (good-fit). The excess is split off & returned as a free
+*                   block.
+*
+*           (2) Each block is preceded by a header that links it to its physical neighbours :
+*
+*               (a) 'Size' holds the size of the block's data area, in octets, a multiple of
+*                   LIB_MEM_TLSF_ALIGN. Its bit 0 is set when the block is free & its bit 1 when the previous
+*                   block is free.
+*
+*               (b) 'PrevPhysPtr' points to the previous block & is only valid when that block is free. It
+*                   is stored in the last octets of the previous block's data area, so an allocated block
+*                   only costs the 'Size' field.
+*
+*               (c) 'NextFreePtr' & 'PrevFreePtr' link a free block in its list & are stored in the block's
+*                   data area. Freed blocks are merged with free neighbours in constant time.
+*
+*                    |<---- Blk hdr ----->|<-------------- Blk data -------------->|
+*                   -+-------------+------+--------------------------+-------------+------+-
+*                    | PrevPhysPtr | Size | NextFreePtr, PrevFreePtr | PrevPhysPtr | Size |
+*                   -+-------------+------+--------------------------+-------------+------+-
+*                      (in prev blk)      ^                          |<-- Next blk hdr -->|
+*                                         |
+*                                         Ptr returned by Mem_TlsfAlloc()
+*
+*           (3) Heap operations are serialized by the optional lock functions passed to Mem_TlsfCreate(),
+*               typically wrapping a kernel mutex; when none are given, critical sections are used instead.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+#if     (CPU_CFG_ADDR_SIZE == CPU_WORD_SIZE_64)                 /* Blk align is the size of a blk hdr field.            */
+#define  LIB_MEM_TLSF_ALIGN_LOG2                          3u
+#elif   (CPU_CFG_ADDR_SIZE == CPU_WORD_SIZE_32)
+#define  LIB_MEM_TLSF_ALIGN_LOG2                          2u
+#else
+#define  LIB_MEM_TLSF_ALIGN_LOG2                          1u
+#endif
+
+#define  LIB_MEM_TLSF_ALIGN                     (1u << LIB_MEM_TLSF_ALIGN_LOG2)
+#define  LIB_MEM_TLSF_SL_CNT                    (1u << LIB_MEM_CFG_TLSF_SL_LOG2)
+#define  LIB_MEM_TLSF_FL_SHIFT                  (LIB_MEM_CFG_TLSF_SL_LOG2 + LIB_MEM_TLSF_ALIGN_LOG2)
+#define  LIB_MEM_TLSF_FL_CNT                    (LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 - LIB_MEM_TLSF_FL_SHIFT + 1u)
+#define  LIB_MEM_TLSF_SIZE_SMALL                ((CPU_SIZE_T)1u << LIB_MEM_TLSF_FL_SHIFT)
+#define  LIB_MEM_TLSF_SIZE_MAX                  ((CPU_SIZE_T)1u << LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2)
+
+
+typedef  struct  mem_tlsf_blk  MEM_TLSF_BLK;                    /* ------------------- TLSF HEAP BLK ------------------ */
+
+struct  mem_tlsf_blk {
+    MEM_TLSF_BLK  *PrevPhysPtr;                                 /* Ptr to prev phys blk, if free   (see Note #2b).      */
+    CPU_SIZE_T     Size;                                        /* Size of blk data & state bits   (see Note #2a).      */
+    MEM_TLSF_BLK  *NextFreePtr;                                 /* Ptr to next free blk in list    (see Note #2c).      */
+    MEM_TLSF_BLK  *PrevFreePtr;                                 /* Ptr to prev free blk in list    (see Note #2c).      */
+};
+
+
+typedef  void  (*MEM_TLSF_LOCK_FNCT)(void  *p_arg);             /* Heap lock/unlock fnct (see Note #3).                 */
+
+
+typedef  struct  mem_tlsf_stat {                                /* ------------------ TLSF HEAP STAT ------------------ */
+    CPU_SIZE_T  SizeTot;                                        /* Size of heap region, in octets.                      */
+    CPU_SIZE_T  SizeUsed;                                       /* Size of alloc'd blks, hdrs incl'd, in octets.        */
+    CPU_SIZE_T  SizeUsedMax;                                    /* Peak size of alloc'd blks, in octets.                */
+    CPU_SIZE_T  BlkUsedCnt;                                     /* Nbr of alloc'd blks.                                 */
+    CPU_SIZE_T  AllocFailCtr;                                   /* Nbr of failed alloc's.                               */
+} MEM_TLSF_STAT;
+
+
+typedef  struct  mem_tlsf {                                     /* ------------------ TLSF HEAP DATA ------------------ */
+           MEM_TLSF_BLK         BlkNull;                        /* Sentinel blk that ends empty free lists.             */
+           CPU_DATA             FL_Bitmap;                      /* Bitmap of non-empty FL classes  (see Note #1a).      */
+                                                                /* Bitmaps of non-empty SL lists   (see Note #1a).      */
+           CPU_DATA             SL_BitmapTbl[LIB_MEM_TLSF_FL_CNT];
+                                                                /* Free lists, per FL class & SL list.                  */
+           MEM_TLSF_BLK        *BlkFreeTbl[LIB_MEM_TLSF_FL_CNT][LIB_MEM_TLSF_SL_CNT];
+
+           CPU_ADDR             AddrStart;                      /* Start addr of heap region.                           */
+           CPU_ADDR             AddrEnd;                        /* End   addr of heap region (last addr).               */
+
+           MEM_TLSF_LOCK_FNCT   LockFnct;                       /* Heap lock   fnct                (see Note #3).       */
+           MEM_TLSF_LOCK_FNCT   UnlockFnct;                     /* Heap unlock fnct                (see Note #3).       */
+           void                *LockArgPtr;                     /* Arg passed to lock/unlock fncts.                     */
+
+           MEM_TLSF_STAT        Stat;                           /* Heap stats.                                          */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR            *NamePtr;                        /* Ptr to heap name.                                    */
+#endif
+} MEM_TLSF;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -1214,6 +1468,12 @@ void               Mem_Copy                 (       void              *pdest,
                                              const  void              *psrc,
                                                     CPU_SIZE_T         size);
 
+#if (LIB_MEM_CFG_POOL_LOCK_FREE_EN == DEF_ENABLED)
+CPU_BOOLEAN        Mem_CmpSwap              (       CPU_INT32U volatile  *p_val,
+                                                    CPU_INT32U            val_old,
+                                                    CPU_INT32U            val_new);
+#endif
+
 void               Mem_Move                 (       void              *pdest,
                                              const  void              *psrc,
                                                     CPU_SIZE_T         size);
@@ -1327,6 +1587,41 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+#if (LIB_MEM_CFG_DYN_POOL_TRIM_EN == DEF_ENABLED)
+CPU_SIZE_T         Mem_DynPoolTrim          (       MEM_DYN_POOL      *p_pool,
+                                                    CPU_SIZE_T         blk_qty_keep,
+                                                    LIB_ERR           *p_err);
+#endif
+
+                                                                /* ------------------ TLSF HEAP FNCTS ----------------- */
+#if (LIB_MEM_CFG_TLSF_EN == DEF_ENABLED)
+void               Mem_TlsfCreate           (const  CPU_CHAR          *p_name,
+                                                    MEM_TLSF          *p_tlsf,
+                                                    MEM_SEG           *p_seg,
+                                                    CPU_SIZE_T         size,
+                                                    MEM_TLSF_LOCK_FNCT lock_fnct,
+                                                    MEM_TLSF_LOCK_FNCT unlock_fnct,
+                                                    void              *p_lock_arg,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_TlsfAlloc            (       MEM_TLSF          *p_tlsf,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_TlsfRealloc          (       MEM_TLSF          *p_tlsf,
+                                                    void              *p_mem,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_TlsfFree             (       MEM_TLSF          *p_tlsf,
+                                                    void              *p_mem,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_TlsfStatGet          (       MEM_TLSF          *p_tlsf,
+                                                    MEM_TLSF_STAT     *p_stat,
+                                                    LIB_ERR           *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1361,6 +1656,47 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_POOL_LOCK_FREE_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_POOL_LOCK_FREE_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_POOL_LOCK_FREE_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                              [MUST be  DEF_DISABLED]           "
+#error  "                              [     ||  DEF_ENABLED ]           "
+#endif
+
+
+#if    ((LIB_MEM_CFG_DYN_POOL_TRIM_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_DYN_POOL_TRIM_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_DYN_POOL_TRIM_EN illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+
+#elif   (LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY < 1u)
+#error  "LIB_MEM_CFG_DYN_POOL_CHUNK_BLK_QTY illegally #define'd in 'lib_cfg.h'"
+#error  "                                   [MUST be  >= 1]                   "
+#endif
+
+
+#if    ((LIB_MEM_CFG_TLSF_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_TLSF_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_TLSF_EN          illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+
+#elif  ((LIB_MEM_CFG_TLSF_SL_LOG2 < 1u) || \
+        (LIB_MEM_CFG_TLSF_SL_LOG2 > 5u))
+#error  "LIB_MEM_CFG_TLSF_SL_LOG2     illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  >= 1]                   "
+#error  "                             [     &&  <= 5]                   "
+
+#elif  ((LIB_MEM_CFG_TLSF_EN            == DEF_ENABLED          ) &&   \
+       ((LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 <= LIB_MEM_TLSF_FL_SHIFT) ||   \
+        (LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2 >= DEF_INT_CPU_NBR_BITS )))
+#error  "LIB_MEM_CFG_TLSF_SIZE_MAX_LOG2  illegally #define'd in 'lib_cfg.h'                      "
+#error  "                                [MUST be  >  LIB_MEM_CFG_TLSF_SL_LOG2 + log2(blk align)]"
+#error  "                                [     &&  <  DEF_INT_CPU_NBR_BITS                      ]"
+#endif
+
+
 #ifndef  LIB_MEM_CFG_HEAP_SIZE
 #error  "LIB_MEM_CFG_HEAP_SIZE              not #define'd in 'lib_cfg.h'"
 #error  "                                   [MUST be  >= 0]             "
@@ -167,7 +167,7 @@
 
 
 #define  OS_HWOS_TASK_SW() do { *((CPU_REG32 *)0xE000ED04) = 0x10000000;} while (0)
-#define  OS_HWOS_TASK_SYNC() do { __ISB(); } while (0)
+#define  OS_HWOS_TASK_SYNC() do { __ISB(); OS_SCHED_DEFER_CHK(); OS_TASK_SUSPEND_CHK(); } while (0)
 
 
 /*
@@ -188,17 +188,20 @@
             break; \
         } \
     } \
-    r1 = RIN32_HWOS->CPUIF.R1; \
-     \
     if(r0 & OS_HWOS_CTX_REQ) { \
         new_ctx_id = (r0 & OS_HWOS_CTX_MASK) >> 16u; \
         OSHWOSPendCtxSw = new_ctx_id; \
         if((r0 & OS_HWOS_RESP_MASK) != 0u) { \
+            r1 = RIN32_HWOS->CPUIF.R1; \
             OSTaskRet[new_ctx_id].r0 = (r0 & OS_HWOS_RESP_MASK); \
             OSTaskRet[new_ctx_id].r1 = r1; \
         } \
-        OS_HWOS_TASK_SW(); \
+        if(new_ctx_id != OSCtxIDCur) { \
+            OS_PRIO_CTX_SW_OUT(OSCtxIDCur); \
+            OS_HWOS_TASK_SW(); \
+        } \
     } else { \
+        r1 = RIN32_HWOS->CPUIF.R1; \
         OSTaskRet[OSCtxIDCur].r0 = (r0 & OS_HWOS_RESP_MASK); \
         OSTaskRet[OSCtxIDCur].r1 = r1; \
     } \
@@ -217,21 +220,23 @@
             break; \
         } \
     } \
-    r1 = RIN32_HWOS->CPUIF.R1; \
-     \
     if(r0 & OS_HWOS_CTX_REQ) { \
         new_ctx_id = (r0 & OS_HWOS_CTX_MASK) >> 16u; \
         OSHWOSPendCtxSw = new_ctx_id; \
         if((r0 & OS_HWOS_RESP_MASK) != 0u) { \
+            r1 = RIN32_HWOS->CPUIF.R1; \
             OSTaskRet[new_ctx_id].r0 = (r0 & OS_HWOS_RESP_MASK); \
             OSTaskRet[new_ctx_id].r1 = r1; \
         } \
         if(OSIntNestingCtr != 0u) { \
             ret_val = 0x01u; \
+        } else if(new_ctx_id != OSCtxIDCur) { \
+            OS_PRIO_CTX_SW_OUT(OSCtxIDCur); \
         } \
         OS_HWOS_TASK_SW(); \
     } else { \
         if((OSIntNestingCtr == 0u) && ((r0 & OS_HWOS_RESP_MASK) != 0u)) { \
+            r1 = RIN32_HWOS->CPUIF.R1; \
             OSTaskRet[OSCtxIDCur].r0 = (r0 & OS_HWOS_RESP_MASK); \
             OSTaskRet[OSCtxIDCur].r1 = r1; \
         } else { \
@@ -240,6 +245,22 @@
     } \
 } while (0)
 
+                                                                /* Wait for the result of a command that can't switch.  */
+                                                                /* Only valid while HWOS dispatching is disabled.       */
+#define  OS_HWOS_CMD_WAIT(resp)   do { \
+    CPU_INT32U   r0; \
+ \
+    while(DEF_TRUE) { \
+        r0 = RIN32_HWOS->CPUIF.R0; \
+        if(r0 & 0x20000000u) { \
+            break; \
+        } \
+    } \
+    resp = (r0 & OS_HWOS_RESP_MASK); \
+} while (0)
+
+#define  OS_HWOS_GET_R1() RIN32_HWOS->CPUIF.R1
+
 
 /*
 *********************************************************************************************************
@@ -247,7 +268,11 @@
 *********************************************************************************************************
 */
 
-void  OS_CPU_SysTickInit (CPU_INT32U  cnts);
+void  OS_CPU_SysTickInit    (CPU_INT32U  cnts);
+
+void  OS_CPU_SysTickHandler (void);
+
+void  OS_CPU_HWOSCtxSwHook  (void);
 
 
 #endif
@@ -129,6 +129,105 @@ CPU_STK  *OS_CPU_TaskInit (OS_TASK_PTR    p_task,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          COMPARE AND SWAP
+*
+* Description: Atomically replace a word by a new value if it still holds the expected value.
+*
+* Arguments  : p_val        Pointer to the word to update.
+*
+*              val_old      Value the word is expected to hold.
+*
+*              val_new      Value to store in the word.
+*
+* Returns    : DEF_OK,   if the word held 'val_old' and now holds 'val_new'.
+*              DEF_FAIL, otherwise.
+*
+* Note(s)    : 1) The exclusive monitor is cleared by every exception entry and return, so a store that
+*                 raced with an interrupt fails and is retried without masking interrupts.
+*
+*              2) This function can be called from a task or from an ISR.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_CPU_CmpSwap (CPU_INT32U  volatile  *p_val,
+                             CPU_INT32U             val_old,
+                             CPU_INT32U             val_new)
+{
+    while (__LDREX((unsigned long *)p_val) == val_old) {
+        if (__STREX(val_new, (unsigned long *)p_val) == 0u) {   /* Store succeeded, nobody touched the word.            */
+            return (DEF_OK);
+        }
+    }
+    __CLREX();                                                  /* Release the monitor on a mismatch.                   */
+
+    return (DEF_FAIL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      POP A NODE FROM A FREE LIST
+*
+* Description: Atomically unlink the first node of a singly linked list.  The first word of each node holds
+*              the pointer to the next node.
+*
+* Arguments  : p_head       Pointer to the head of the list.
+*
+* Returns    : A pointer to the node that was unlinked, DEF_NULL if the list is empty.
+*
+* Note(s)    : 1) The link of the first node is read between the exclusive load and store of the head.  Any
+*                 write to the head in between, or any interrupt, makes the store fail and the pop is retried.
+*                 The store can thus never install a stale link, even if the same node was popped and pushed
+*                 back in the meantime.
+*
+*              2) This function can be called from a task or from an ISR.
+*********************************************************************************************************
+*/
+
+void  *OS_CPU_ListPop (void  *volatile  *p_head)
+{
+    void  *p_node;
+
+
+    do {
+        p_node = (void *)__LDREX((unsigned long *)p_head);
+        if (p_node == DEF_NULL) {
+            __CLREX();                                          /* Release the monitor, the list is empty.              */
+            return (DEF_NULL);
+        }
+    } while (__STREX((unsigned long)*(void **)p_node, (unsigned long *)p_head) != 0u);
+
+    return (p_node);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      PUSH A NODE ON A FREE LIST
+*
+* Description: Atomically link a node in front of a singly linked list.
+*
+* Arguments  : p_head       Pointer to the head of the list.
+*
+*              p_node       Pointer to the node to link.  Its first word is overwritten with the link.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called from a task or from an ISR.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_ListPush (void  *volatile  *p_head,
+                       void             *p_node)
+{
+    do {
+       *(void **)p_node = (void *)__LDREX((unsigned long *)p_head);
+    } while (__STREX((unsigned long)p_node, (unsigned long *)p_head) != 0u);
+}
+
+
 /*
 *********************************************************************************************************
 *                                         INITIALIZE SYS TICK
@@ -138,10 +237,75 @@ CPU_STK  *OS_CPU_TaskInit (OS_TASK_PTR    p_task,
 * Arguments  : cnts         Number of SysTick counts between two OS tick interrupts.
 *
 * Note(s)    : 1) This function MUST be called after OSStart() & after processor initialization.
+*
+*              2) The HWOS counts timeouts on its own.  The CPU SysTick is only started when round-robin
+*                 scheduling or sub-priorities are enabled, see OSTimeTick().
 *********************************************************************************************************
 */
 
 void  OS_CPU_SysTickInit (CPU_INT32U  cnts)
 {
     RIN32_HWOS->CMN.WT_TO_PRESCL = cnts;
+
+#if (OS_TICK_EN == DEF_ENABLED)
+    CPU_REG_NVIC_ST_RELOAD = cnts;                              /* Same period as the HWOS tick.                        */
+    CPU_IntSrcPrioSet(CPU_INT_SYSTICK, 14u);                    /* Same priority as the HWOS interrupt.                 */
+                                                                /* Enable timer and interrupt.                          */
+    CPU_REG_NVIC_ST_CTRL  |= CPU_REG_NVIC_ST_CTRL_CLKSOURCE |
+                             CPU_REG_NVIC_ST_CTRL_TICKINT  |
+                             CPU_REG_NVIC_ST_CTRL_ENABLE;
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                          SYS TICK HANDLER
+*
+* Description: Handle the SysTick interrupt, which drives OSTimeTick().
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) This function MUST be placed on entry 15 of the Cortex-M3 vector table.
+*********************************************************************************************************
+*/
+
+void  OS_CPU_SysTickHandler (void)
+{
+#if (OS_TICK_EN == DEF_ENABLED)
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    OSIntEnter();                                               /* Tell uC/OS-III HW-RTOS that we are starting an ISR.  */
+    CPU_CRITICAL_EXIT();
+
+    OSTimeTick();
+
+    CPU_CRITICAL_ENTER();
+    OSIntExit();                                                /* Tell uC/OS-III HW-RTOS that we are leaving the ISR.  */
+    CPU_CRITICAL_EXIT();
+#endif
+}
+
+
+/*
+*********************************************************************************************************
+*                                     HWOS CONTEXT SWITCH HOOK
+*
+* Description: Called by OS_CPU_HWOSCtxSwHandler() when the HWOS requests a context switch by itself, once
+*              the pending context id is stored.
+*
+* Arguments  : None.
+*
+* Note(s)    : 1) Interrupts are disabled.
+*
+*              2) The tasks readied by the HWOS are ordered within their band, which can pend a switch to
+*                 another context (see 'os.h  SUB-PRIORITY MACROS  Note #3').
+*********************************************************************************************************
+*/
+
+void  OS_CPU_HWOSCtxSwHook (void)
+{
+    OS_PRIO_CTX_SW_IN();
 }
@@ -49,6 +49,7 @@
     IMPORT  OSTaskRet
     IMPORT  OSHWOSPendCtxSw
     IMPORT  OS_CPU_ExceptStkBase
+    IMPORT  OS_CPU_HWOSCtxSwHook
 
 
 ;********************************************************************************************************
@@ -75,6 +76,12 @@ OS_CPU_Start
 ;                                   HWOS CONTEXT SWITCH HANDLER
 ;
 ; Note(s) : 1) This function process an asynchronous context switch from the HWOS.
+;
+;           2) The response is only handed over to the new context when it is not zero, R1 is only read
+;              in that case.
+;
+;           3) OS_CPU_HWOSCtxSwHook() orders the tasks the HWOS readied before the switch is performed, it
+;              may update the pending context id.
 ;********************************************************************************************************
 
 OS_CPU_HWOSCtxSwHandler
@@ -87,25 +94,24 @@ wait1
     ANDS  r1, r0, #R0_INTERCEPT
     BEQ   wait1
 
-    LDR   r1, [r2, #0x24]
-
-    AND   r2, r0, #R0_CONTEXT_ID_MASK
-
-    UXTH  r3, r0
-    CMP   r3, #0000
-    BEQ   hwrtos_ctx_isr_skip_ret
+    UBFX  r12, r0, #16, #8                                      ; Pending context id
+    UXTH  r3, r0                                                ; Response code
+    CBZ   r3, hwrtos_ctx_isr_skip_ret                           ; No response to hand over
 
+    LDR    r1, [r2, #0x24]
     MOV32  r0, OSTaskRet
-    ADD    r0, r0, r2, LSR #13
-    STR    r3, [r0, #0]
-    STR    r1, [r0, #4]
+    ADD    r0, r0, r12, LSL #3                                  ; &OSTaskRet[ctx_id]
+    STRD   r3, r1, [r0]
 
 
 hwrtos_ctx_isr_skip_ret
 
-    MOV32 r12, OSHWOSPendCtxSw
-    LSR   r2, r2, #16
-    STR   r2, [r12]
+    MOV32 r0, OSHWOSPendCtxSw
+    STR   r12, [r0]
+
+    PUSH  {r0, lr}
+    BL    OS_CPU_HWOSCtxSwHook                                  ; See Note #3.
+    POP   {r0, lr}
 
     MOV32 r0, #NVIC_PENDSVSET
     MOV   r1, #0x10000000
@@ -128,28 +134,33 @@ hwrtos_ctx_isr_skip_ret
 ;           2) Since PendSV is set to lowest priority in the system (by OSStartHighRdy() above), we
 ;              know that it will only be run when no other exception or interrupt is active, and
 ;              therefore safe to assume that context being switched out was using the process stack (PSP).
+;
+;           3) When the pending context is the current one (e.g. a switch that was undone before PendSV
+;              ran), R4-R11 and the stack pointer are left untouched.
 ;********************************************************************************************************
 
 OS_CPU_PendSVHandler
     CPSID   I                             ; Prevent interruption during context switch
+    MOV32   r12,OSCtxIDCur
+    MOV32   r1, OSHWOSPendCtxSw
+    LDR     r3, [r12]                     ; Load current context id
+    LDR     r1, [r1]                      ; Load pending context id
+    CMP     r1, r3
+    BEQ     pendsv_skip                   ; Nothing to switch
+
     MRS     r0, PSP
     STMFD   r0!, {R4-R11}
 
-    MOV32   r12,OSCtxIDCur
     MOV32   r2, OSTaskStkPtrTbl
-    LDR     r3, [r12]                     ; Load current context id
     STR     r0, [r2, r3, LSL #2]          ; Current stack pointer
+    LDR     r0, [r2, r1, LSL #2]          ; Load new stack pointer
+    STR     r1, [r12]                     ; Store new current context id
 
-    MOV32   r11,OSHWOSPendCtxSw
-    MOV32   r0, OSTaskStkPtrTbl
-    LDR     r4, [r11]                     ; Load pending context id
-    LDR     r0, [r0, r4, LSL #2]          ; Load new stack pointer
-    STR     r4, [r12]                     ; Store new current context id
-
-
-    ORR     lr, lr, #0x04                 ; Ensure exception return uses process stack
     LDMFD   r0!, {r4-r11}                 ; Restore r4-11 from new process stack
     MSR     PSP, r0                       ; Load PSP with new process SP
+
+pendsv_skip
+    ORR     lr, lr, #0x04                 ; Ensure exception return uses process stack
     CPSIE   I
     BX      lr                            ; Exception return will restore remaining context
 
@@ -49,6 +49,7 @@
 #include  <os_cfg_app.h>
 #include  <cpu_core.h>
 #include  <lib_def.h>
+#include  <lib_mem.h>
 #include  <os_hwrtos.h>
 
 
@@ -75,6 +76,331 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                              PRIORITIES
+*
+* Note(s) : (1) OS_CFG_PRIO_MAX is the number of logical task priorities, the lowest one being reserved for the
+*               idle task.  By default, there is one logical priority per HWOS priority.
+*
+*           (2) When OS_CFG_PRIO_MAX is larger than the number of HWOS priorities, the logical priorities are
+*               folded linearly onto the HWOS priority bands and the tasks sharing a band are ordered by the
+*               sub-priority scheduler (see os_prio.c).  The idle task keeps the lowest band for itself.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_PRIO_MAX
+#define  OS_CFG_PRIO_MAX       (OS_HWOS_MAX_PRIO + 1u)
+#endif
+
+#if     (OS_CFG_PRIO_MAX < (OS_HWOS_MAX_PRIO + 1u))
+#error  "os_cfg.h, OS_CFG_PRIO_MAX must be >= (OS_HWOS_MAX_PRIO + 1)"
+#elif   (OS_CFG_PRIO_MAX > 256u)
+#error  "os_cfg.h, OS_CFG_PRIO_MAX must be <= 256"
+#elif   (OS_CFG_PRIO_MAX > (OS_HWOS_MAX_PRIO + 1u))
+#define  OS_PRIO_SUB_EN        DEF_ENABLED
+#define  OS_PRIO_TO_HW(prio)   (((CPU_INT32U)(prio) >= (OS_CFG_PRIO_MAX - 1u)) ? OS_HWOS_MAX_PRIO : \
+                                (((CPU_INT32U)(prio) * OS_HWOS_MAX_PRIO) / (OS_CFG_PRIO_MAX - 1u)))
+#else
+#define  OS_PRIO_SUB_EN        DEF_DISABLED
+#define  OS_PRIO_TO_HW(prio)   ((CPU_INT32U)(prio))
+#endif
+
+#define  OS_PRIO_TBL_SIZE      (OS_HWOS_CNTX_CNT / 32u)         /* Size of the ready context bitmaps.                   */
+
+                                                                /* The OS tick is needed to count the time slices ...   */
+                                                                /* ... and to order the tasks readied by the HWOS.      */
+#if ((OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED) || (OS_PRIO_SUB_EN == DEF_ENABLED))
+#define  OS_TICK_EN            DEF_ENABLED
+#else
+#define  OS_TICK_EN            DEF_DISABLED
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            DYNAMIC TASKS
+*
+* Note(s) : (1) The TCBs and stacks of the tasks created by OSTaskCreateDyn() are allocated from
+*               OSCfg_TaskDynMem[].  The stacks are split into OS_CFG_TASK_DYN_STK_CLASS_NBR size classes,
+*               each class being twice as large as the previous one, starting at OS_CFG_TASK_DYN_STK_SIZE_MIN.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_TASK_DYN_EN
+#define  OS_CFG_TASK_DYN_EN    DEF_DISABLED
+#endif
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+#ifndef  OS_CFG_TASK_DYN_MEM_SIZE
+#error  "os_cfg_app.h, Missing OS_CFG_TASK_DYN_MEM_SIZE: Must be > 0"
+#elif   (OS_CFG_TASK_DYN_MEM_SIZE == 0u)
+#error  "os_cfg_app.h, OS_CFG_TASK_DYN_MEM_SIZE must be > 0"
+#endif
+
+#ifndef  OS_CFG_TASK_DYN_STK_SIZE_MIN
+#error  "os_cfg_app.h, Missing OS_CFG_TASK_DYN_STK_SIZE_MIN: Must be > 0"
+#elif   (OS_CFG_TASK_DYN_STK_SIZE_MIN == 0u)
+#error  "os_cfg_app.h, OS_CFG_TASK_DYN_STK_SIZE_MIN must be > 0"
+#endif
+
+#ifndef  OS_CFG_TASK_DYN_STK_CLASS_NBR
+#error  "os_cfg_app.h, Missing OS_CFG_TASK_DYN_STK_CLASS_NBR: Must be [1..8]"
+#elif  ((OS_CFG_TASK_DYN_STK_CLASS_NBR == 0u) || (OS_CFG_TASK_DYN_STK_CLASS_NBR > 8u))
+#error  "os_cfg_app.h, OS_CFG_TASK_DYN_STK_CLASS_NBR must be [1..8]"
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             WORK QUEUE
+*
+* Note(s) : (1) The jobs submitted with OSWorkSubmit() are run by OS_CFG_WORK_TASK_NBR worker tasks, see
+*               os_work.c.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_WORK_EN
+#define  OS_CFG_WORK_EN        DEF_DISABLED
+#endif
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+#if (OS_CFG_SEM_EN != DEF_ENABLED)
+#error  "os_cfg.h, OS_CFG_WORK_EN requires OS_CFG_SEM_EN"
+#endif
+
+#ifndef  OS_CFG_WORK_Q_SIZE
+#error  "os_cfg_app.h, Missing OS_CFG_WORK_Q_SIZE: Must be a power of 2"
+#elif  ((OS_CFG_WORK_Q_SIZE < 2u) || ((OS_CFG_WORK_Q_SIZE & (OS_CFG_WORK_Q_SIZE - 1u)) != 0u))
+#error  "os_cfg_app.h, OS_CFG_WORK_Q_SIZE must be a power of 2, >= 2"
+#endif
+
+#ifndef  OS_CFG_WORK_TASK_NBR
+#error  "os_cfg_app.h, Missing OS_CFG_WORK_TASK_NBR: Must be > 0"
+#elif   (OS_CFG_WORK_TASK_NBR == 0u)
+#error  "os_cfg_app.h, OS_CFG_WORK_TASK_NBR must be > 0"
+#endif
+
+#ifndef  OS_CFG_WORK_TASK_PRIO
+#error  "os_cfg_app.h, Missing OS_CFG_WORK_TASK_PRIO"
+#elif   (OS_CFG_WORK_TASK_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+#error  "os_cfg_app.h, OS_CFG_WORK_TASK_PRIO must be < (OS_CFG_PRIO_MAX - 1)"
+#endif
+
+#ifndef  OS_CFG_WORK_TASK_STK_SIZE
+#error  "os_cfg_app.h, Missing OS_CFG_WORK_TASK_STK_SIZE"
+#endif
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       DEFERRED INTERRUPT WORK
+*
+* Note(s) : (1) The jobs deferred by the ISRs with OSIntDefer() are run by the interrupt deferral task, see
+*               os_work.c.  There is one queue per deferral priority, queue 0 being served first.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_INT_DEFER_EN
+#define  OS_CFG_INT_DEFER_EN   DEF_DISABLED
+#endif
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+#if (OS_CFG_SEM_EN != DEF_ENABLED)
+#error  "os_cfg.h, OS_CFG_INT_DEFER_EN requires OS_CFG_SEM_EN"
+#endif
+
+#ifndef  OS_CFG_INT_DEFER_Q_SIZE
+#error  "os_cfg_app.h, Missing OS_CFG_INT_DEFER_Q_SIZE: Must be a power of 2"
+#elif  ((OS_CFG_INT_DEFER_Q_SIZE < 2u) || ((OS_CFG_INT_DEFER_Q_SIZE & (OS_CFG_INT_DEFER_Q_SIZE - 1u)) != 0u))
+#error  "os_cfg_app.h, OS_CFG_INT_DEFER_Q_SIZE must be a power of 2, >= 2"
+#endif
+
+#ifndef  OS_CFG_INT_DEFER_PRIO_NBR
+#error  "os_cfg_app.h, Missing OS_CFG_INT_DEFER_PRIO_NBR: Must be [1..8]"
+#elif  ((OS_CFG_INT_DEFER_PRIO_NBR == 0u) || (OS_CFG_INT_DEFER_PRIO_NBR > 8u))
+#error  "os_cfg_app.h, OS_CFG_INT_DEFER_PRIO_NBR must be [1..8]"
+#endif
+
+#ifndef  OS_CFG_INT_DEFER_TASK_PRIO
+#error  "os_cfg_app.h, Missing OS_CFG_INT_DEFER_TASK_PRIO"
+#elif   (OS_CFG_INT_DEFER_TASK_PRIO >= (OS_CFG_PRIO_MAX - 1u))
+#error  "os_cfg_app.h, OS_CFG_INT_DEFER_TASK_PRIO must be < (OS_CFG_PRIO_MAX - 1)"
+#endif
+
+#ifndef  OS_CFG_INT_DEFER_TASK_STK_SIZE
+#error  "os_cfg_app.h, Missing OS_CFG_INT_DEFER_TASK_STK_SIZE"
+#endif
+#endif
+
+                                                                /* Work queue rings are shared by both services.        */
+#if ((OS_CFG_WORK_EN == DEF_ENABLED) || (OS_CFG_INT_DEFER_EN == DEF_ENABLED))
+#define  OS_WORK_Q_EN          DEF_ENABLED
+#else
+#define  OS_WORK_Q_EN          DEF_DISABLED
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          ASYNCHRONOUS POSTS
+*
+* Note(s) : (1) The posts made with OSSemPostAsync(), OSFlagPostAsync() and OSQPostAsync() return as soon as their
+*               command is issued, without waiting for the HWOS to complete it.  The result is collected by
+*               OS_PostAsyncCollect() before the next HWOS command is built, whoever builds it.  This is why
+*               each command sequence starts with OS_HWOS_CMD_SYNC(), before its first register is written.
+*               Commands that follow within the same critical section don't need it again.
+*
+*           (2) The asynchronous posts are made with the context switch deferred, as with OS_OPT_POST_NO_SCHED,
+*               so that the HWOS never switches on their behalf while the calling task keeps running.  The
+*               switch is only held until the next call to the kernel made by the calling task, which collects
+*               the result first (see 'DEFERRED CONTEXT SWITCH MACROS  Note #1').
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_POST_ASYNC_EN
+#define  OS_CFG_POST_ASYNC_EN  DEF_DISABLED
+#endif
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+#define  OS_HWOS_CMD_SYNC()    do { if (OSPostAsyncPend != DEF_NO) { OS_PostAsyncCollect(); } } while (0u)
+#else
+#define  OS_HWOS_CMD_SYNC()
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          OBJECT STATISTICS
+*
+* Note(s) : (1) The semaphores, mutexes, queues and event flag groups count their posts and pends, the pends
+*               that blocked or timed out, their waiting tasks and the time spent blocked on them, in CPU_TS
+*               units.  The counters are dumped with OSStatObjIterate(), see os_stat.c.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_STAT_OBJ_EN
+#define  OS_CFG_STAT_OBJ_EN    DEF_DISABLED
+#endif
+
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+#if (CPU_CFG_TS_32_EN != DEF_ENABLED)
+#error  "cpu_cfg.h, OS_CFG_STAT_OBJ_EN requires CPU_CFG_TS_32_EN"
+#endif
+
+#define  OS_OBJ_STAT_POST(p_obj)   do { (p_obj)->Stat.PostCtr++; } while (0u)
+#else
+#define  OS_OBJ_STAT_POST(p_obj)
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          MEMORY PARTITIONS
+*
+* Note(s) : (1) The free blocks of a partition are linked through their first word.  The blocks are taken
+*               from and returned to the list with OS_CPU_ListPop() and OS_CPU_ListPush(), without masking
+*               interrupts, see os_mem.c.
+*
+*           (2) With OS_CFG_MEM_MAG_EN, a partition given a magazine table with OSMemMagSet() keeps up to
+*               OS_CFG_MEM_MAG_SIZE free blocks per context.  The magazines are refilled from and drained to
+*               the free list by halves, OS_MEM_MAG_BATCH blocks at a time.
+*
+*           (3) With OS_CFG_MEM_PEND_EN, each partition owns a HW semaphore on which OSMemPend() waits for a
+*               block to reach the free list.  The semaphore does not count the free blocks, it only wakes
+*               up the waiting tasks, since a HW semaphore cannot count past OS_HWOS_SEM_VAL_MAX.
+*
+*           (4) With OS_CFG_DBG_EN, each partition tracks its lowest number of free blocks and the gets that
+*               found it empty.  A partition given an owner table with OSMemOwnerTblSet() also records the
+*               context that got each block, OS_MEM_OWNER_ISR for an ISR or OS_MEM_OWNER_NONE if the block
+*               is free.  OSMemOutputUsage() reports all the partitions.
+*
+*           (5) With OS_CFG_MEM_SLAB_EN, up to OS_CFG_MEM_SLAB_CLASS_NBR partitions added with OSMemSlabAdd()
+*               form the size classes of OSMemSlabAlloc() and OSMemSlabFree(), sorted by block size.
+*
+*           (6) With OS_CFG_MEM_MSG_EN, OSMemMsgGet() reserves an OS_MEM_MSG header at the start of the block
+*               and hands out the payload that follows it.  The header records the partition, the length of
+*               the payload and the number of owners, so the payload can be passed through queues without
+*               being copied and released with OSMemMsgRelease() by its last owner.
+*
+*           (7) With OS_CFG_MEM_BUF_EN, a buffer chain is a list of OS_MEM_BUF descriptors, each giving an
+*               offset and a length in the payload of a zero-copy message.  The descriptors are got from the
+*               partition set with OSMemBufDescSet().  Each descriptor owns one reference to its message, so
+*               chains can share payload bytes and be built, split and cloned without copying them.
+*********************************************************************************************************
+*/
+
+#ifndef  OS_CFG_MEM_EN
+#define  OS_CFG_MEM_EN         DEF_DISABLED
+#endif
+
+#ifndef  OS_CFG_MEM_MAG_EN
+#define  OS_CFG_MEM_MAG_EN     DEF_DISABLED
+#endif
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+#ifndef  OS_CFG_MEM_MAG_SIZE
+#error  "os_cfg.h, Missing OS_CFG_MEM_MAG_SIZE"
+#elif   (OS_CFG_MEM_MAG_SIZE < 2u)
+#error  "os_cfg.h, OS_CFG_MEM_MAG_SIZE must be >= 2"
+#endif
+
+#define  OS_MEM_MAG_BATCH     (OS_CFG_MEM_MAG_SIZE / 2u)
+#endif
+
+#ifndef  OS_CFG_MEM_PEND_EN
+#define  OS_CFG_MEM_PEND_EN    DEF_DISABLED
+#endif
+
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+#if (OS_CFG_SEM_EN != DEF_ENABLED)
+#error  "os_cfg.h, OS_CFG_MEM_PEND_EN requires OS_CFG_SEM_EN"
+#endif
+#endif
+
+#ifndef  OS_CFG_MEM_SLAB_EN
+#define  OS_CFG_MEM_SLAB_EN    DEF_DISABLED
+#endif
+
+#if (OS_CFG_MEM_SLAB_EN == DEF_ENABLED)
+#ifndef  OS_CFG_MEM_SLAB_CLASS_NBR
+#error  "os_cfg.h, Missing OS_CFG_MEM_SLAB_CLASS_NBR"
+#elif   (OS_CFG_MEM_SLAB_CLASS_NBR < 1u)
+#error  "os_cfg.h, OS_CFG_MEM_SLAB_CLASS_NBR must be >= 1"
+#endif
+#endif
+
+#ifndef  OS_CFG_MEM_MSG_EN
+#define  OS_CFG_MEM_MSG_EN     DEF_DISABLED
+#endif
+
+#if (OS_CFG_MEM_MSG_EN == DEF_ENABLED)
+#if (OS_CFG_Q_EN != DEF_ENABLED)
+#error  "os_cfg.h, OS_CFG_MEM_MSG_EN requires OS_CFG_Q_EN"
+#endif
+                                                                /* Header size, rounded up to keep the payload aligned. */
+#define  OS_MEM_MSG_HDR_SIZE  ((sizeof(OS_MEM_MSG) + sizeof(CPU_ALIGN) - 1u) & ~(sizeof(CPU_ALIGN) - 1u))
+#define  OS_MEM_MSG_HDR(p_data)  ((OS_MEM_MSG *)(void *)((CPU_INT08U *)(p_data) - OS_MEM_MSG_HDR_SIZE))
+#endif
+
+#ifndef  OS_CFG_MEM_BUF_EN
+#define  OS_CFG_MEM_BUF_EN     DEF_DISABLED
+#endif
+
+#if (OS_CFG_MEM_BUF_EN == DEF_ENABLED)
+#if (OS_CFG_MEM_MSG_EN != DEF_ENABLED)
+#error  "os_cfg.h, OS_CFG_MEM_BUF_EN requires OS_CFG_MEM_MSG_EN"
+#endif
+                                                                /* First payload byte of a chain piece.                 */
+#define  OS_MEM_BUF_DATA(p_buf)  ((void *)((CPU_INT08U *)(p_buf)->DataPtr + (p_buf)->Offset))
+#endif
+
+#define  OS_MEM_OWNER_ISR      0xFEu                            /* Block owned by an ISR or got before OSStart().       */
+#define  OS_MEM_OWNER_NONE     0xFFu                            /* Free block.                                          */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -242,6 +568,7 @@ typedef  enum  os_err {
     OS_ERR_TASK_SUSPEND_ISR          = 29021u,
     OS_ERR_TASK_SUSPEND_PRIO         = 29022u,
     OS_ERR_TASK_WAITING              = 29023u,
+    OS_ERR_TASK_SUSPEND_CTR_OVF      = 29024u,
 
     OS_ERR_TCB_INVALID               = 29101u,
 
@@ -288,6 +615,7 @@ typedef  enum  os_err {
     OS_ERR_V                         = 31000u,
 
     OS_ERR_W                         = 32000u,
+    OS_ERR_WORK_Q_FULL               = 32001u,
 
     OS_ERR_X                         = 33000u,
 
@@ -394,6 +722,29 @@ typedef  enum  os_err {
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 TASK SUSPEND STATES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_TASK_SUSPEND_NONE                (CPU_INT08U)(0u)   /* Not suspended                                      */
+#define  OS_TASK_SUSPEND_PEND                (CPU_INT08U)(1u)   /* Sleeps on its next call to the kernel              */
+#define  OS_TASK_SUSPEND_STOP                (CPU_INT08U)(2u)   /* Stopped in the HWOS by ter_tsk                     */
+#define  OS_TASK_SUSPEND_SLP                 (CPU_INT08U)(3u)   /* Sleeps in OS_TaskSuspendWait()                     */
+
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                              DEFERRED CONTEXT SWITCH STATES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_SCHED_DEFER_NONE                 (CPU_INT08U)(0u)   /* No context switch is held                          */
+#define  OS_SCHED_DEFER_POST                 (CPU_INT08U)(1u)   /* Held by the post being made                        */
+#define  OS_SCHED_DEFER_HELD                 (CPU_INT08U)(2u)   /* Released by the next call to the kernel            */
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -429,6 +780,20 @@ typedef  enum  os_err {
 #define  OS_OPT_QINT_DISABLED                (OS_OPT)(0x0001u)  /* Specifies that the qint be diksabled by default.     */
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    HW ISR ACTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_HWISR_ACTION_SEM_POST            (OS_HWISR_ACTION)(0u)  /* Post a semaphore                               */
+#define  OS_HWISR_ACTION_FLAG_POST           (OS_HWISR_ACTION)(1u)  /* Set event flags                                */
+#define  OS_HWISR_ACTION_TASK_RESUME         (OS_HWISR_ACTION)(2u)  /* Wake up a task from OSTimeDly()                */
+#define  OS_HWISR_ACTION_PEND_ABORT          (OS_HWISR_ACTION)(3u)  /* Abort the pend of a task                       */
+
+#define  OS_HWISR_ACTION_NBR                                    4u  /* Number of HW ISR actions                       */
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                    TIMER OPTIONS
@@ -479,6 +844,7 @@ typedef  enum  os_err {
 #define  OS_OBJ_TYPE_TICK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'I', 'C', 'K')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
 #define  OS_OBJ_TYPE_TASK                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'C', 'B', ' ')
+#define  OS_OBJ_TYPE_TASK_DYN                (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'D', 'Y', 'N')
 
 
 /*
@@ -524,6 +890,7 @@ typedef   CPU_INT16U      OS_MEM_SIZE;                          /* Size in bytes
 
 typedef   CPU_INT32U      OS_QINT_ID;                           /* QINT signal id                                       */
 typedef   CPU_INT32U      OS_INT_ID;                            /* Interrupt signal id                                  */
+typedef   CPU_INT08U      OS_HWISR_ACTION;                      /* HW ISR action                                        */
 
 
 /*
@@ -539,6 +906,7 @@ typedef  void                      (*OS_TASK_PTR)(void *p_arg);
 
 
 typedef  struct  os_sem              OS_SEM;
+typedef  struct  os_sem_batch        OS_SEM_BATCH;
 typedef  struct  os_sem              OS_MUTEX;
 
 typedef  struct  os_q                OS_Q;
@@ -548,6 +916,23 @@ typedef  struct  os_flag_grp         OS_FLAG_GRP;
 typedef  struct  os_hwos_ret         OS_HWOS_RET;
 
 typedef  struct  os_mem              OS_MEM;
+typedef  struct  os_mem_mag          OS_MEM_MAG;
+typedef  struct  os_mem_msg          OS_MEM_MSG;
+typedef  struct  os_mem_buf          OS_MEM_BUF;
+typedef  struct  os_mem_buf_sg       OS_MEM_BUF_SG;
+
+typedef  struct  os_work             OS_WORK;
+typedef  void                      (*OS_WORK_FNCT)(void *p_arg);
+
+typedef  struct  os_work_q           OS_WORK_Q;
+
+typedef  struct  os_hwisr_q          OS_HWISR_Q;
+
+typedef  struct  os_obj_stat         OS_OBJ_STAT;
+typedef  void                      (*OS_OBJ_STAT_FNCT)(void         *p_obj,
+                                                       OS_OBJ_TYPE   type,
+                                                       OS_OBJ_STAT  *p_stat,
+                                                       void         *p_arg);
 
 
 /*
@@ -568,7 +953,40 @@ struct os_tcb {
     CPU_CHAR    *NamePtr;                                       /* Task Name.                                           */
 #endif
     OS_TICK      TickCtrPrev;                                   /* Used by OSTimeDlyXX() in PERIODIC mode.              */
+    OS_PRIO      Prio;                                          /* Task priority.                                       */
+    OS_NESTING_CTR SuspendCtr;                                  /* Nesting counter for OSTaskSuspend().                 */
+    CPU_INT08U   SuspendState;                                  /* How the task is held by OSTaskSuspend().             */
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    OS_NESTING_CTR MutexCtr;                                    /* Number of mutexes held by the task.                  */
+#endif
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+    OS_TICK      TimeQuanta;                                    /* Round-robin time slice, 0 for the default.           */
+    OS_TICK      TimeQuantaCtr;                                 /* Ticks remaining in the current time slice.           */
+#endif
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    CPU_INT32U   PrioSeq;                                       /* Order in which the task became ready.                */
+#endif
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+    CPU_STK     *DynStkBasePtr;                                 /* Stack allocated by OSTaskCreateDyn().                */
+    CPU_INT08U   DynStkClass;                                   /* Stack size class of the stack.                       */
+    OS_TCB      *DynNextPtr;                                    /* Next task on the reaper list.                        */
+    OS_OBJ_TYPE  DynType;                                       /* OS_OBJ_TYPE_TASK_DYN while the task can be deleted.  */
+#endif
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+    OS_ERR       PostAsyncErr;                                  /* First error of the task's asynchronous posts.        */
+#endif
+
+};
+
 
+struct  os_obj_stat {                                           /* Post/pend statistics of a kernel object.             */
+    OS_CTR      PostCtr;                                        /* Number of posts.                                     */
+    OS_CTR      PendCtr;                                        /* Number of pends, polls included.                     */
+    OS_CTR      PendBlockCtr;                                   /* Number of pends that blocked.                        */
+    OS_CTR      PendTimeoutCtr;                                 /* Number of pends that timed out.                      */
+    OS_OBJ_QTY  WaitNbr;                                        /* Number of tasks blocked on the object.               */
+    OS_OBJ_QTY  WaitNbrMax;                                     /* Peak number of tasks blocked on the object.          */
+    CPU_INT64U  BlockTimeTot;                                   /* Total time blocked on the object, in CPU_TS units.   */
 };
 
 
@@ -581,6 +999,21 @@ struct  os_sem {                                                /* Semaphore.
     CPU_CHAR   *NamePtr;                                        /* Mutex Name.                                          */
 #endif
     CPU_INT32U  Mutex;                                          /* DEF_YES if semaphore is a mutex.                     */
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_OBJ_STAT Stat;                                           /* Post/pend statistics.                                */
+#endif
+};
+
+
+/*
+* Note(s) : (1) A semaphore event batch only saves wake ups of the consumer.  Its events are counted by
+*               OSSemBatchPost() in the CPU ISR of the peripheral, so each event still costs a CPU interrupt.
+*/
+
+struct  os_sem_batch {                                          /* Events counted by an ISR, signaled in batches.       */
+    OS_SEM                *SemPtr;                              /* Semaphore posted when the batch is complete.         */
+    OS_SEM_CTR             Batch;                               /* Number of events per wake up.                        */
+    OS_SEM_CTR   volatile  Ctr;                                 /* Events counted since the batch was last taken.       */
 };
 
 
@@ -592,6 +1025,9 @@ struct  os_q {                                                  /* Message Queue
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     CPU_CHAR   *NamePtr;                                        /* Queue Name.                                          */
 #endif
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_OBJ_STAT Stat;                                           /* Post/pend statistics.                                */
+#endif
 };
 
 
@@ -603,6 +1039,35 @@ struct  os_flag_grp {                                           /* Event Flags
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     CPU_CHAR   *NamePtr;                                        /* Flag Group Name.                                     */
 #endif
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_OBJ_STAT Stat;                                           /* Post/pend statistics.                                */
+#endif
+};
+
+
+struct os_work {                                                /* Work queue slot.                                     */
+    OS_WORK_FNCT volatile FnctPtr;                              /* Function to run.                                     */
+    void        *volatile ArgPtr;                               /* Argument passed to the function.                     */
+    CPU_INT32U  volatile Seq;                                   /* Position for which the slot is free or full.         */
+};
+
+
+struct os_work_q {                                              /* Lock-free MPMC work queue.                           */
+    OS_WORK             *SlotTbl;                               /* Slots, the size is a power of 2.                     */
+    CPU_INT32U           Mask;                                  /* Number of slots - 1.                                 */
+    CPU_INT32U  volatile InIx;                                  /* Next position to fill.                               */
+    CPU_INT32U  volatile OutIx;                                 /* Next position to empty.                              */
+};
+
+
+struct os_hwisr_q {                                             /* Descriptor ring fed by an ISR stub.                  */
+    void        *volatile *SlotTbl;                             /* Descriptors, the size is a power of 2.               */
+    CPU_INT32U             Mask;                                /* Number of slots - 1.                                 */
+    CPU_INT32U   volatile  InIx;                                /* Next slot to fill, written by the ISR stub only.     */
+    CPU_INT32U   volatile  OutIx;                               /* Next slot to empty, written by the consumer only.    */
+    CPU_INT32U   volatile  OvfCtr;                              /* Descriptors dropped because the ring was full.       */
+    OS_SEM                *SemPtr;                              /* Semaphore posted by the HW ISR.                      */
+    OS_QINT_ID             QIntID;                              /* QINT signal of the ring.                             */
 };
 
 
@@ -613,24 +1078,70 @@ struct os_hwos_ret {                                            /* HWOS return v
 
 
 struct os_mem {                                             /* MEMORY CONTROL BLOCK                                   */
-#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
     OS_OBJ_TYPE          Type;                              /* Should be set to OS_OBJ_TYPE_MEM                       */
 #endif
     void                *AddrPtr;                           /* Pointer to beginning of memory partition               */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     CPU_CHAR            *NamePtr;
 #endif
-    void                *FreeListPtr;                       /* Pointer to list of free memory blocks                  */
+    void       *volatile FreeListPtr;                       /* Pointer to list of free memory blocks                  */
     OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
     OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
-    OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+    CPU_INT32U  volatile NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    OS_MEM_MAG          *MagTbl;                            /* Per context magazines, OS_HWOS_CNTX_CNT entries        */
+#endif
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+    OS_SEM               Sem;                               /* Signaled when a block is freed and tasks are waiting   */
+    CPU_INT32U  volatile PendCtr;                           /* Number of tasks in OSMemPend()                         */
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MEM              *DbgPrevPtr;
     OS_MEM              *DbgNextPtr;
+    CPU_INT32U  volatile DbgNbrFreeMin;                     /* Lowest number of free blocks                           */
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    CPU_INT32U  volatile DbgNbrMag;                         /* Number of free blocks held in the magazines            */
+#endif
+    CPU_INT32U  volatile DbgFailCtr;                        /* Number of gets that found the partition empty          */
+    CPU_INT08U          *DbgOwnerTbl;                       /* Context owning each block, see OSMemOwnerTblSet()      */
+#endif
+};
+
+
+#if (OS_CFG_MEM_MSG_EN == DEF_ENABLED)
+struct os_mem_msg {                                         /* ZERO-COPY MESSAGE HEADER                               */
+    OS_MEM              *MemPtr;                            /* Partition the block belongs to                         */
+    CPU_INT32U  volatile RefCtr;                            /* Number of owners of the message                        */
+    OS_MSG_SIZE          Len;                               /* Length (in bytes) of the payload                       */
+};
 #endif
+
+
+#if (OS_CFG_MEM_BUF_EN == DEF_ENABLED)
+struct os_mem_buf {                                         /* BUFFER CHAIN DESCRIPTOR                                */
+    OS_MEM_BUF          *NextPtr;                           /* Next piece of the chain                                */
+    void                *DataPtr;                           /* Payload of the zero-copy message holding the bytes     */
+    OS_MSG_SIZE          Offset;                            /* Offset of the first byte in the payload                */
+    OS_MSG_SIZE          Len;                               /* Number of bytes                                        */
 };
 
 
+struct os_mem_buf_sg {                                      /* SCATTER-GATHER ENTRY                                   */
+    void                *AddrPtr;                           /* First byte of the piece                                */
+    CPU_INT32U           Len;                               /* Number of bytes                                        */
+};
+#endif
+
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+struct os_mem_mag {                                         /* MEMORY PARTITION MAGAZINE                              */
+    OS_MEM_QTY           NbrBlk;                            /* Number of blocks in the magazine                       */
+    void                *BlkTbl[OS_CFG_MEM_MAG_SIZE];       /* Free blocks, the most recently freed one last          */
+};
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -646,6 +1157,7 @@ OS_EXT  volatile  CPU_INT32U             OSHWOSPendCtxSw;       /* Pending conte
 
 OS_EXT  volatile  CPU_STK               *OSTaskStkPtrTbl[OS_HWOS_CNTX_CNT + 1u]; /* Task stack pointers.                */
 OS_EXT  volatile  OS_HWOS_RET            OSTaskRet[OS_HWOS_CNTX_CNT]; /* Global task return values.                     */
+OS_EXT            OS_TCB                *OSTaskTCBPtrTbl[OS_HWOS_CNTX_CNT]; /* Task TCB pointers.                       */
 OS_EXT            OS_HWOS_RET            OSISRRet;              /* ISR return value.                                    */
 
 
@@ -656,9 +1168,58 @@ OS_EXT            CPU_STK                OSCfg_IdleTaskStk [OS_CFG_IDLE_TASK_STK
 OS_EXT            OS_SEM                *OSSemPtrTbl[OS_HWOS_SEM_CNT]; /* Semaphore table.                              */
 OS_EXT            OS_Q                  *OSQPtrTbl[OS_HWOS_Q_CNT]; /* Queue table.                                      */
 OS_EXT            OS_FLAG_GRP           *OSGrpPtrTbl[OS_HWOS_FLAG_CNT]; /* Flag table.                                  */
+OS_EXT            OS_HWISR_Q            *OSHWISRQPtrTbl[OS_HWOS_HWISR_CNT]; /* HW ISR descriptor rings.                 */
 
 
 OS_EXT  volatile  OS_NESTING_CTR         OSIntNestingCtr;       /* Interrupt nesting level                              */
+OS_EXT            OS_NESTING_CTR         OSDispatchDisCtr;      /* HWOS dispatch disable nesting level.                 */
+OS_EXT            CPU_INT08U             OSSchedDeferred;       /* A context switch is held by OS_OPT_POST_NO_SCHED.    */
+OS_EXT            OS_NESTING_CTR         OSSchedLockNestingCtr; /* Lock nesting level                                   */
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+OS_EXT  volatile  CPU_BOOLEAN            OSPostAsyncPend;       /* An asynchronous post awaits its result.              */
+OS_EXT            CPU_INT32U             OSPostAsyncCtxID;      /* Context that issued the asynchronous post.           */
+OS_EXT            CPU_INT32U             OSPostAsyncCmd;        /* HWOS command of the asynchronous post.               */
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+OS_EXT            CPU_BOOLEAN            OSSchedRoundRobinEn;   /* Enable/disable round-robin scheduling                */
+OS_EXT            OS_TICK                OSSchedRoundRobinDfltTimeQuanta; /* Default time slice.                        */
+#endif
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+OS_EXT            CPU_INT32U             OSPrioRdyTbl[OS_PRIO_TBL_SIZE]; /* Ready contexts ordered in their band.       */
+OS_EXT            CPU_INT32U             OSPrioChkTbl[OS_PRIO_TBL_SIZE]; /* Contexts to look at in OS_PrioSched().      */
+OS_EXT            CPU_INT32U             OSPrioSeqCtr;          /* Ready sequence counter.                              */
+#endif
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+                                                                /* Dynamic task memory.                                 */
+OS_EXT            CPU_ALIGN              OSCfg_TaskDynMem[OS_CFG_TASK_DYN_MEM_SIZE / sizeof(CPU_ALIGN)];
+OS_EXT            MEM_SEG                OSTaskDynSeg;          /* Dynamic task memory segment.                         */
+OS_EXT            MEM_DYN_POOL           OSTaskDynTCBPool;      /* Dynamic task TCB pool.                               */
+OS_EXT            MEM_DYN_POOL           OSTaskDynStkPool[OS_CFG_TASK_DYN_STK_CLASS_NBR]; /* Dyn task stack pools.      */
+OS_EXT            OS_TCB                *OSTaskDynReapListPtr;  /* Deleted tasks whose memory must be freed.            */
+OS_EXT            OS_OBJ_QTY             OSTaskDynReapCtr;      /* Number of tasks on the reaper list.                  */
+#endif
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+OS_EXT            OS_WORK_Q              OSWorkQ;               /* Work queue.                                          */
+OS_EXT            OS_WORK                OSCfg_WorkQTbl[OS_CFG_WORK_Q_SIZE]; /* Work queue slots.                       */
+OS_EXT            OS_SEM                 OSWorkSem;             /* Signaled when jobs are submitted.                    */
+OS_EXT            OS_TCB                 OSWorkTaskTCBTbl[OS_CFG_WORK_TASK_NBR]; /* Worker task TCBs.                   */
+                                                                /* Worker task stacks.                                  */
+OS_EXT            CPU_STK                OSCfg_WorkTaskStk[OS_CFG_WORK_TASK_NBR][OS_CFG_WORK_TASK_STK_SIZE];
+#endif
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+OS_EXT            OS_WORK_Q              OSIntDeferQTbl[OS_CFG_INT_DEFER_PRIO_NBR]; /* Deferral queues.                 */
+                                                                /* Deferral queue slots.                                */
+OS_EXT            OS_WORK                OSCfg_IntDeferQSlotTbl[OS_CFG_INT_DEFER_PRIO_NBR][OS_CFG_INT_DEFER_Q_SIZE];
+OS_EXT            OS_SEM                 OSIntDeferSem;         /* Signaled when jobs are deferred.                     */
+OS_EXT            OS_TCB                 OSIntDeferTaskTCB;     /* Deferral task TCB.                                   */
+OS_EXT            CPU_STK                OSCfg_IntDeferTaskStk[OS_CFG_INT_DEFER_TASK_STK_SIZE]; /* Deferral task stack. */
+#endif
 
 OS_EXT            CPU_STK                OS_CPU_ExceptStk[OS_CFG_ISR_STK_SIZE]; /* Exception stack.                     */
 OS_EXT            CPU_STK               *OS_CPU_ExceptStkBase;  /* Exception stack base.                                */
@@ -668,6 +1229,14 @@ OS_EXT            CPU_STK               *OS_CPU_ExceptStkBase;  /* Exception sta
 OS_EXT            OS_MEM                   *OSMemDbgListPtr;
 #endif
 OS_EXT            OS_OBJ_QTY                OSMemQty;           /* Number of memory partitions created                  */
+#if (OS_CFG_MEM_BUF_EN == DEF_ENABLED)
+OS_EXT            OS_MEM                   *OSMemBufDescPtr;    /* Partition of the buffer chain descriptors            */
+#endif
+#if (OS_CFG_MEM_SLAB_EN == DEF_ENABLED)
+OS_EXT            OS_MEM                   *OSMemSlabTbl[OS_CFG_MEM_SLAB_CLASS_NBR]; /* Size classes, by block size     */
+OS_EXT            CPU_INT08U                OSMemSlabClassTbl[DEF_INT_CPU_NBR_BITS + 1u]; /* First class per power of 2 */
+OS_EXT            CPU_INT08U                OSMemSlabClassNbr;  /* Number of size classes                               */
+#endif
 #endif
 
 
@@ -683,6 +1252,83 @@ OS_EXT            OS_OBJ_QTY                OSMemQty;           /* Number of mem
 #define  OSIntExit()  do { OSIntNestingCtr--; } while (0u)
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        SUB-PRIORITY MACROS
+*
+* Note(s) : (1) The posts are bracketed by OS_PRIO_SCHED_ENTER() and OS_PRIO_SCHED_EXIT() so that the tasks they
+*               ready are ordered within their band before the HWOS dispatches them.  OS_PRIO_SCHED_EXIT()
+*               fetches the result of the post before re-enabling dispatching overwrites it.
+*
+*           (2) OS_PRIO_CTX_SW_OUT() is called by the port when a command switches away from the task that
+*               issued it, so that the task is looked at again once it is readied.
+*
+*           (3) OS_PRIO_CTX_SW_IN() is called by the port when the HWOS requests a context switch by itself, so
+*               that the tasks it readied (timeouts, HW ISRs) are ordered before they run.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+#define  OS_PRIO_SCHED_ENTER()         do { OS_DispatchDis(); } while (0u)
+#define  OS_PRIO_SCHED_EXIT(ret_val)   do { if ((ret_val) == 0u) { (ret_val) = OSTaskRet[OSCtxIDCur].r0; } \
+                                            OS_DispatchEn(); } while (0u)
+#define  OS_PRIO_CTX_SW_OUT(ctx_id)    do { OS_PrioCtxSwOut(ctx_id); } while (0u)
+#define  OS_PRIO_CTX_SW_IN()           do { OS_PrioSchedChk(); } while (0u)
+#else
+#define  OS_PRIO_SCHED_ENTER()
+#define  OS_PRIO_SCHED_EXIT(ret_val)
+#define  OS_PRIO_CTX_SW_OUT(ctx_id)
+#define  OS_PRIO_CTX_SW_IN()
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       DEFERRED CONTEXT SWITCH MACROS
+*
+* Note(s) : (1) OS_SCHED_DEFER_CHK() is called by the port each time a task returns from an HWOS command.  A context
+*               switch held by OS_SchedDefer() survives the return from the post that deferred it, and is released
+*               on the return from the next call to the kernel, unless that call defers it again.  A sequence of
+*               posts made with OS_OPT_POST_NO_SCHED thus requests a single switch, and the switch is never held
+*               past the end of that sequence.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  OS_SCHED_DEFER_CHK()          do { if ((OSSchedDeferred != OS_SCHED_DEFER_NONE) && (OSIntNestingCtr == 0u)) { \
+                                                if (OSSchedDeferred == OS_SCHED_DEFER_POST) { \
+                                                    OSSchedDeferred = OS_SCHED_DEFER_HELD; \
+                                                } else { \
+                                                    OS_SchedFlush(); } } } while (0u)
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         TASK SUSPEND MACROS
+*
+* Note(s) : (1) OS_TASK_SUSPEND_CHK() is called by the port each time a task returns from an HWOS command.  A
+*               task that was suspended by another task but not stopped in the HWOS (it was waiting, or held a
+*               mutex) goes to sleep there, see OSTaskSuspend().
+*
+*           (2) Without OSTaskSuspend(), the check is compiled out of the HWOS command path.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
+#define  OS_TASK_SUSPEND_CHK()         do { if ((OSIntNestingCtr == 0u) && (OSCtxIDCur < OS_HWOS_CNTX_CNT) && \
+                                                (OSTaskTCBPtrTbl[OSCtxIDCur] != DEF_NULL) && \
+                                                (OSTaskTCBPtrTbl[OSCtxIDCur]->SuspendState == OS_TASK_SUSPEND_PEND)) { \
+                                                 OS_TaskSuspendWait(); } } while (0u)
+#else
+#define  OS_TASK_SUSPEND_CHK()
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -722,6 +1368,12 @@ OS_OBJ_QTY    OSSemPendAbort            (OS_SEM                *p_sem,
 OS_SEM_CTR    OSSemPost                 (OS_SEM                *p_sem,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void          OSSemPostAsync            (OS_SEM                *p_sem,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_SEM_DEL_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSSemDel                  (OS_SEM                *p_sem,
                                          OS_OPT                 opt,
@@ -734,6 +1386,21 @@ void          OSSemSet                  (OS_SEM                *p_sem,
                                          OS_ERR                *p_err);
 #endif
 
+void          OSSemBatchSet             (OS_SEM_BATCH          *p_batch,
+                                         OS_SEM                *p_sem,
+                                         OS_SEM_CTR             batch,
+                                         OS_ERR                *p_err);
+
+CPU_BOOLEAN   OSSemBatchPost            (OS_SEM_BATCH          *p_batch);
+
+OS_SEM_CTR    OSSemPendBatch            (OS_SEM_BATCH          *p_batch,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+CPU_INT32U    OS_SemPostAll             (OS_SEM                *p_sem);
+
 #endif /* OS_CFG_SEM_EN == DEF_ENABLED */
 
 
@@ -787,12 +1454,24 @@ void          OSQPost                   (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void          OSQPostAsync              (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_Q_DEL_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 #endif /* OS_CFG_Q_DEL_EN == DEF_ENABLED */
 
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+CPU_INT32U    OS_QPostAll               (OS_Q                  *p_q,
+                                         void                  *p_void);
+
 #endif /* OS_CFG_Q_EN == DEF_ENABLED */
 
 
@@ -823,6 +1502,13 @@ OS_FLAGS      OSFlagPost                (OS_FLAG_GRP           *p_grp,
                                          OS_FLAGS               flags,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void          OSFlagPostAsync           (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
 #endif /* OS_CFG_FLAG_EN == DEF_ENABLED */
 
 
@@ -832,8 +1518,26 @@ OS_FLAGS      OSFlagPost                (OS_FLAG_GRP           *p_grp,
 
 void          OSInit                    (OS_ERR                *p_err);
 
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void          OSPostAsyncCollect        (OS_ERR                *p_err);
+#endif
+
 void          OSStart                   (OS_ERR                *p_err);
 
+void          OSSched                   (void);
+
+void          OSSchedLock               (OS_ERR                *p_err);
+
+void          OSSchedUnlock             (OS_ERR                *p_err);
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void          OSSchedRoundRobinCfg      (CPU_BOOLEAN            en,
+                                         OS_TICK                dflt_time_quanta,
+                                         OS_ERR                *p_err);
+
+void          OSSchedRoundRobinYield    (OS_ERR                *p_err);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                                 TASK MANAGEMENT                                                    */
@@ -859,19 +1563,57 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+OS_TCB       *OSTaskCreateDyn           (CPU_CHAR              *p_name,
+                                         OS_TASK_PTR            p_task,
+                                         void                  *p_arg,
+                                         OS_PRIO                prio,
+                                         CPU_STK_SIZE           stk_size,
+                                         OS_MSG_QTY             q_size,
+                                         OS_TICK                time_quanta,
+                                         void                  *p_ext,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
 
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
 void          OSTaskSuspend             (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 
 
 void          OSTaskResume              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void          OSTaskTimeQuantaSet       (OS_TCB                *p_tcb,
+                                         OS_TICK                time_quanta,
+                                         OS_ERR                *p_err);
+#endif
 
 #if (OS_CFG_TASK_DEL_EN == DEF_ENABLED)
 void          OSTaskDel                 (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+void          OSTaskDelDyn              (OS_TCB                *p_tcb,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_TaskDynInit            (OS_ERR                *p_err);
+
+CPU_BOOLEAN   OS_TaskDynIsLive          (OS_TCB                *p_tcb);
+
+void          OS_TaskDynReap            (void);
+#endif
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
+void          OS_TaskSuspendWait        (void);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                                 TIME MANAGEMENT                                                    */
@@ -897,6 +1639,10 @@ void          OSTimeDlyResume           (OS_TCB                *p_tcb,
 
 OS_TICK       OSTimeGet                 (OS_ERR                *p_err);
 
+#if (OS_TICK_EN == DEF_ENABLED)
+void          OSTimeTick                (void);
+#endif
+
 void          OSTimeSet                 (OS_TICK                ticks,
                                          OS_ERR                *p_err);
 
@@ -916,10 +1662,105 @@ void          OSMemCreate               (OS_MEM                *p_mem,
 void         *OSMemGet                  (OS_MEM                *p_mem,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void          OSMemOutputUsage          (void                 (*out_fnct)(CPU_CHAR *),
+                                         OS_ERR                *p_err);
+
+void          OSMemOwnerTblSet          (OS_MEM                *p_mem,
+                                         CPU_INT08U            *p_tbl,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MEM_SLAB_EN == DEF_ENABLED)
+void          OSMemSlabAdd              (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void         *OSMemSlabAlloc            (CPU_SIZE_T             size,
+                                         OS_ERR                *p_err);
+
+void          OSMemSlabFree             (void                  *p_blk,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MEM_BUF_EN == DEF_ENABLED)
+OS_MEM_BUF   *OSMemBufCat               (OS_MEM_BUF            *p_head,
+                                         OS_MEM_BUF            *p_tail,
+                                         OS_ERR                *p_err);
+
+OS_MEM_BUF   *OSMemBufClone             (OS_MEM_BUF            *p_chain,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufDescSet           (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void          OSMemBufFree              (OS_MEM_BUF            *p_chain,
+                                         OS_ERR                *p_err);
+
+OS_MEM_BUF   *OSMemBufGet               (void                  *p_data,
+                                         OS_MSG_SIZE            offset,
+                                         OS_MSG_SIZE            len,
+                                         OS_ERR                *p_err);
+
+CPU_INT32U    OSMemBufLenGet            (OS_MEM_BUF            *p_chain);
+
+OS_OBJ_QTY    OSMemBufSGGet             (OS_MEM_BUF            *p_chain,
+                                         OS_MEM_BUF_SG         *p_sg_tbl,
+                                         OS_OBJ_QTY             sg_nbr,
+                                         OS_ERR                *p_err);
+
+OS_MEM_BUF   *OSMemBufSplit             (OS_MEM_BUF            *p_chain,
+                                         CPU_INT32U             offset,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MEM_MSG_EN == DEF_ENABLED)
+void         *OSMemMsgGet               (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void         *OSMemMsgPend              (OS_Q                  *p_q,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_len,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSMemMsgPost              (OS_Q                  *p_q,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            len,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+OS_OBJ_QTY    OSMemMsgPostMulti         (OS_Q                 **p_q_tbl,
+                                         OS_OBJ_QTY             q_nbr,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            len,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSMemMsgRelease           (void                  *p_data,
+                                         OS_ERR                *p_err);
+#endif
+
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+void         *OSMemPend                 (OS_MEM                *p_mem,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSMemPut                  (OS_MEM                *p_mem,
                                          void                  *p_blk,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+void          OSMemMagFlush             (OS_MEM                *p_mem,
+                                         OS_ERR                *p_err);
+
+void          OSMemMagSet               (OS_MEM                *p_mem,
+                                         OS_MEM_MAG            *p_mag_tbl,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -931,6 +1772,93 @@ void          OS_MemInit                (OS_ERR                *p_err);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                PRIORITY MANAGEMENT                                                 */
+/* ================================================================================================================== */
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+void          OS_PrioInit               (void);
+
+void          OS_PrioSched              (void);
+
+void          OS_PrioSchedChk           (void);
+
+void          OS_PrioRdyClr             (CPU_INT32U             ctx_id);
+
+void          OS_PrioCtxSwOut           (CPU_INT32U             ctx_id);
+
+CPU_BOOLEAN   OS_PrioYield              (OS_TCB                *p_tcb);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                    WORK QUEUE                                                      */
+/* ================================================================================================================== */
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+void          OSWorkSubmit              (OS_WORK_FNCT           p_fnct,
+                                         void                  *p_arg,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_WorkInit               (OS_ERR                *p_err);
+
+void          OS_WorkTask               (void                  *p_arg);
+#endif
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+void          OSIntDefer                (OS_WORK_FNCT           p_fnct,
+                                         void                  *p_arg,
+                                         OS_PRIO                prio,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_IntDeferInit           (OS_ERR                *p_err);
+
+void          OS_IntDeferTask           (void                  *p_arg);
+#endif
+
+#if (OS_WORK_Q_EN == DEF_ENABLED)
+void          OS_WorkQInit              (OS_WORK_Q             *p_q,
+                                         OS_WORK               *p_slot_tbl,
+                                         CPU_INT32U             size);
+
+CPU_BOOLEAN   OS_WorkQPut               (OS_WORK_Q             *p_q,
+                                         OS_WORK_FNCT           p_fnct,
+                                         void                  *p_arg);
+
+CPU_BOOLEAN   OS_WorkQGet               (OS_WORK_Q             *p_q,
+                                         OS_WORK_FNCT          *p_fnct,
+                                         void                 **p_arg);
+#endif
+
+
+/* ================================================================================================================== */
+/*                                                 OBJECT STATISTICS                                                  */
+/* ================================================================================================================== */
+
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+void          OSStatObjIterate          (OS_OBJ_STAT_FNCT       p_fnct,
+                                         void                  *p_arg,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_ObjStatClr             (OS_OBJ_STAT           *p_stat);
+
+CPU_BOOLEAN   OS_ObjStatPend            (OS_OBJ_STAT           *p_stat);
+
+void          OS_ObjStatPendEnd         (OS_OBJ_STAT           *p_stat,
+                                         CPU_BOOLEAN            blocked,
+                                         CPU_TS                 ts_start,
+                                         CPU_INT32U             resp);
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                   HW ISR                                                           */
 /* ================================================================================================================== */
@@ -954,6 +1882,34 @@ void          OSHWISRTaskResumeSet      (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+void          OSHWISRSet                (OS_QINT_ID             qint_id,
+                                         OS_INT_ID              int_id,
+                                         OS_HWISR_ACTION        action,
+                                         void                  *p_obj,
+                                         CPU_INT32U             param,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+CPU_INT32U    OSHWISRFreeGet            (OS_ERR                *p_err);
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+void          OSHWISRQSet               (OS_HWISR_Q            *p_q,
+                                         void                 **p_slot_tbl,
+                                         CPU_INT32U             size,
+                                         OS_SEM                *p_sem,
+                                         OS_QINT_ID             qint_id,
+                                         OS_INT_ID              int_id,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+CPU_BOOLEAN   OSHWISRQPost              (OS_QINT_ID             qint_id,
+                                         void                  *p_desc);
+
+void         *OSHWISRQPend              (OS_HWISR_Q            *p_q,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSHWISREn                 (OS_QINT_ID             qint_id,
                                          OS_ERR                *p_err);
 
@@ -975,6 +1931,22 @@ void          OS_IdleTask               (void                  *p_arg);
 
 void          OS_IdleTaskInit           (OS_ERR                *p_err);
 
+void          OS_DispatchDis            (void);
+
+void          OS_DispatchEn             (void);
+
+void          OS_SchedDefer             (void);
+
+void          OS_SchedFlush             (void);
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void          OS_PostAsyncCollect       (void);
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void          OS_SchedRoundRobin        (void);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -993,4 +1965,13 @@ CPU_STK      *OS_CPU_TaskInit           (OS_TASK_PTR    p_task,
                                          CPU_STK       *p_stk_base,
                                          CPU_STK_SIZE   stk_size);
 
+CPU_BOOLEAN   OS_CPU_CmpSwap            (CPU_INT32U  volatile  *p_val,
+                                         CPU_INT32U             val_old,
+                                         CPU_INT32U             val_new);
+
+void         *OS_CPU_ListPop            (void        *volatile  *p_head);
+
+void          OS_CPU_ListPush           (void        *volatile  *p_head,
+                                         void                   *p_node);
+
 #endif
@@ -77,7 +77,25 @@ void  OSInit (OS_ERR  *p_err)
 
     OSCtxIDCur = 64u;
 
+    OSDispatchDisCtr = 0u;
+    OSSchedDeferred  = OS_SCHED_DEFER_NONE;
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+    OSPostAsyncPend  = DEF_NO;
+#endif
+
+    OSSchedLockNestingCtr = 0u;
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+    OSSchedRoundRobinEn             = DEF_DISABLED;
+    OSSchedRoundRobinDfltTimeQuanta = OS_CFG_TICK_RATE_HZ / 10u;
+#endif
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    OS_PrioInit();
+#endif
+
     for (i = 0; i < 64; i++) {
+        OSTaskTCBPtrTbl[i] = DEF_NULL;
         RIN32_HWOS->CNTX[i].CNTX_TYPE = 0x03;
         RIN32_HWOS->CNTX[i].CNTX_STAT = 0x01;
         RIN32_HWOS->CNTX[i].INIT_ADD = 0u;
@@ -95,6 +113,11 @@ void  OSInit (OS_ERR  *p_err)
         RIN32_HWOS->MBX_TBL[i] = 0x00000000;
     }
     RIN32_HWOS->HWISR.QINT = 0x00000000;
+    for (i = 0u; i < OS_HWOS_HWISR_CNT; i++) {                  /* All the QINT signals start free.                     */
+        RIN32_HWOS->QINTSEL[i]         = 0u;
+        RIN32_HWOS->HWISR.HWISP_OPR[i] = 0u;
+        OSHWISRQPtrTbl[i]              = DEF_NULL;
+    }
 
     RIN32_HWOS->HWISR.HWISR_PNTR[0] = 0x03020100;
     RIN32_HWOS->HWISR.HWISR_PNTR[1] = 0x07060504;
@@ -107,6 +130,34 @@ void  OSInit (OS_ERR  *p_err)
 
     OS_IdleTaskInit(&os_err);
 
+#if (OS_CFG_MEM_EN == DEF_ENABLED)
+    OS_MemInit(&os_err);
+#endif
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+    OS_TaskDynInit(&os_err);
+    if (os_err != OS_ERR_NONE) {
+       *p_err = os_err;
+        return;
+    }
+#endif
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+    OS_WorkInit(&os_err);
+    if (os_err != OS_ERR_NONE) {
+       *p_err = os_err;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+    OS_IntDeferInit(&os_err);
+    if (os_err != OS_ERR_NONE) {
+       *p_err = os_err;
+        return;
+    }
+#endif
+
     OS_CPU_ExceptStkBase = &OS_CPU_ExceptStk[OS_CFG_ISR_STK_SIZE];
 
     *p_err = OS_ERR_NONE;
@@ -152,6 +203,381 @@ void  OSStart (OS_ERR  *p_err)
 }
 
 
+/*
+*********************************************************************************************************
+*                                              SCHEDULER
+*
+* Description: This function performs the context switch held back by posts made with OS_OPT_POST_NO_SCHED.
+*              A task can make several such posts and call OSSched() once, so that a single context switch
+*              is requested for all the tasks that were readied.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function has no effect when called from an ISR.
+*
+*              2) A deferred context switch is also performed when the calling task blocks, or on its next call
+*                 to the kernel other than a post made with OS_OPT_POST_NO_SCHED.
+*********************************************************************************************************
+*/
+
+void  OSSched (void)
+{
+    if (OSIntNestingCtr > 0u) {                                 /* ISRs switch on exit.                                 */
+        return;
+    }
+
+    OS_SchedFlush();
+}
+
+
+/*
+*********************************************************************************************************
+*                                      PREVENT SCHEDULING
+*
+* Description: This function is used to prevent rescheduling from taking place.  This allows your application
+*              to prevent context switches until you are ready to permit context switching.  Interrupts stay
+*              enabled and ISRs can still post, the tasks they ready only run once the scheduler is unlocked.
+*
+* Arguments  : p_err     Pointer to a variable that will receive an error code:
+*
+*                            OS_ERR_NONE                 The scheduler is locked
+*                            OS_ERR_LOCK_NESTING_OVF     If you attempted to nest call to this function > 250 levels
+*                            OS_ERR_OS_NOT_RUNNING       If uC/OS-III HW-RTOS is not running yet.
+*                            OS_ERR_SCHED_LOCK_ISR       If you called this function from an ISR.
+*
+* Returns    : none
+*
+* Note(s)    : 1) You MUST invoke OSSchedLock() and OSSchedUnlock() in pair.  In other words, for every
+*                 call to OSSchedLock() you MUST have a call to OSSchedUnlock().
+*
+*              2) The calling task can't block while the scheduler is locked.  Blocking pends are turned into
+*                 polls and return OS_ERR_SCHED_LOCKED when the object is not available.
+*********************************************************************************************************
+*/
+
+void  OSSchedLock (OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_SCHED_LOCK_ISR;
+        return;
+    }
+#endif
+
+    if (OSRunning != 1u) {                                      /* Make sure multitasking is running                    */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+
+    if (OSSchedLockNestingCtr >= (OS_NESTING_CTR)250u) {        /* Prevent OSSchedLockNestingCtr overflowing            */
+       *p_err = OS_ERR_LOCK_NESTING_OVF;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OSSchedLockNestingCtr++;                                    /* Increment lock nesting level                         */
+    OS_DispatchDis();
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      ENABLE SCHEDULING
+*
+* Description: This function is used to re-allow rescheduling.  Once the outermost lock is released, a single
+*              context switch is requested if a higher priority task was readied while the scheduler was
+*              locked.
+*
+* Arguments  : p_err     Pointer to a variable that will contain an error code returned by this function
+*
+*                            OS_ERR_NONE                 The scheduler has been enabled
+*                            OS_ERR_OS_NOT_RUNNING       If uC/OS-III HW-RTOS is not running yet.
+*                            OS_ERR_SCHED_LOCKED         The scheduler is still locked, still nested
+*                            OS_ERR_SCHED_NOT_LOCKED     The scheduler was not locked
+*                            OS_ERR_SCHED_UNLOCK_ISR     If you called this function from an ISR.
+*
+* Returns    : none
+*
+* Note(s)    : 1) You MUST invoke OSSchedLock() and OSSchedUnlock() in pair.  In other words, for every call
+*                 to OSSchedLock() you MUST have a call to OSSchedUnlock().
+*********************************************************************************************************
+*/
+
+void  OSSchedUnlock (OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_SCHED_UNLOCK_ISR;
+        return;
+    }
+#endif
+
+    if (OSRunning != 1u) {                                      /* Make sure multitasking is running                    */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+
+    if (OSSchedLockNestingCtr == 0u) {                          /* See if the scheduler is locked                       */
+       *p_err = OS_ERR_SCHED_NOT_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OSSchedLockNestingCtr--;                                    /* Decrement lock nesting level                         */
+    OS_DispatchEn();                                            /* Switches if this was the outermost lock.             */
+    if (OSSchedLockNestingCtr > 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_SCHED_LOCKED;                            /* Scheduler is still locked                            */
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+    OS_HWOS_TASK_SYNC();
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                 CONFIGURE ROUND-ROBIN SCHEDULING PARAMETERS
+*
+* Description: This function is called to change the round-robin scheduling parameters.
+*
+* Arguments  : en                determines whether round-robin will be enabled (when DEF_EN) or not (when DEF_DIS)
+*
+*              dflt_time_quanta  default number of ticks between time slices.  0 means assumes OSCfg_TickRate_Hz / 10.
+*
+*              p_err             is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE    The call was successful
+*
+* Returns    : none
+*
+* Note(s)    : 1) Time slices are counted by the OS tick interrupt, see OS_CPU_SysTickHandler().  When a task
+*                 uses up its time slice, the HWOS ready queue of its priority is rotated (rot_rdq) so that
+*                 the next ready task of the same priority runs.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void  OSSchedRoundRobinCfg (CPU_BOOLEAN   en,
+                            OS_TICK       dflt_time_quanta,
+                            OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (en != DEF_ENABLED) {
+        OSSchedRoundRobinEn = DEF_DISABLED;
+    } else {
+        OSSchedRoundRobinEn = DEF_ENABLED;
+    }
+
+    if (dflt_time_quanta > 0u) {
+        OSSchedRoundRobinDfltTimeQuanta = dflt_time_quanta;
+    } else {
+        OSSchedRoundRobinDfltTimeQuanta = OS_CFG_TICK_RATE_HZ / 10u;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    YIELD CPU WHEN TASK NO LONGER NEEDS THE TIME SLICE
+*
+* Description: This function is called to give up the CPU when it is done executing before its time slice
+*              expires.
+*
+* Argument(s): p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE                   The call was successful
+*                             OS_ERR_ROUND_ROBIN_1          Only 1 task at this priority, nothing to yield to
+*                             OS_ERR_ROUND_ROBIN_DISABLED   Round Robin is not enabled
+*                             OS_ERR_SCHED_LOCKED           The scheduler has been locked
+*                             OS_ERR_YIELD_ISR              Can't be called from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called from a task.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void  OSSchedRoundRobinYield (OS_ERR  *p_err)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   ctx_id;
+    CPU_BOOLEAN  rdy;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_YIELD_ISR;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't yield if the scheduler is locked               */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    if (OSSchedRoundRobinEn != DEF_ENABLED) {                   /* Make sure round-robin has been enabled               */
+       *p_err = OS_ERR_ROUND_ROBIN_DISABLED;
+        return;
+    }
+
+    OS_SchedFlush();                                            /* Release a deferred switch before yielding.           */
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskTCBPtrTbl[OSCtxIDCur];
+
+    rdy = DEF_NO;                                               /* See if another task is ready at the same priority.   */
+    for (ctx_id = 0u; ctx_id < OS_HWOS_CNTX_CNT; ctx_id++) {
+        if ((OSTaskTCBPtrTbl[ctx_id] != DEF_NULL) &&
+            (OSTaskTCBPtrTbl[ctx_id]->Prio == p_tcb->Prio) &&
+            (OS_HWOS_GET_CNTX_STAT(ctx_id) == OS_HWOS_CNTS_STAT_RDY)) {
+            rdy = DEF_YES;
+            break;
+        }
+    }
+
+    if (rdy == DEF_NO) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_ROUND_ROBIN_1;
+        return;
+    }
+
+    if (p_tcb->TimeQuanta == 0u) {                              /* Start a new time slice for the yielding task.        */
+        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
+    } else {
+        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;
+    }
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    OS_DispatchDis();                                           /* Move the task behind its logical priority peers.     */
+    (void)OS_PrioYield(p_tcb);
+    OS_DispatchEn();
+#else
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(OS_PRIO_TO_HW(p_tcb->Prio));                 /* Priority of the ready queue to rotate.               */
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_ROT_RDQ);
+
+    OS_HWOS_CMD_PROC();
+#endif
+
+    CPU_CRITICAL_EXIT();
+    OS_HWOS_TASK_SYNC();
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   COLLECT THE ASYNCHRONOUS POSTS
+*
+* Description: This function waits for the HWOS to complete the outstanding asynchronous post, if any, performs
+*              the context switch held back by the asynchronous posts and returns the first error reported for
+*              the posts made asynchronously by the calling task since the previous call.
+*
+* Arguments  : p_err     Pointer to a variable that will receive an error code:
+*
+*                            OS_ERR_NONE                 All the asynchronous posts of the task succeeded
+*                            OS_ERR_OBJ_DEL              An object was deleted before its post was processed
+*                            OS_ERR_OS_NOT_RUNNING       If uC/OS-III HW-RTOS is not running yet.
+*                            OS_ERR_POST_ISR             If you called this function from an ISR
+*                            OS_ERR_Q_FULL               A message was posted to a full queue
+*                            OS_ERR_SEM_OVF              A semaphore count overflowed
+*
+* Returns    : none
+*
+* Note(s)    : 1) The result of an asynchronous post is collected by the next HWOS command anyway.  OSSched() also
+*                 performs the held context switch, without checking the result.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void  OSPostAsyncCollect (OS_ERR  *p_err)
+{
+    OS_TCB  *p_tcb;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+    if (OSRunning != 1u) {                                      /* Make sure multitasking is running                    */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_HWOS_CMD_SYNC();                                         /* Complete the outstanding post, if any.               */
+
+    p_tcb               = OSTaskTCBPtrTbl[OSCtxIDCur];
+   *p_err               = p_tcb->PostAsyncErr;
+    p_tcb->PostAsyncErr = OS_ERR_NONE;
+    CPU_CRITICAL_EXIT();
+
+    OS_SchedFlush();                                            /* Run the tasks readied by the posts.                  */
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      INITIALIZE THE IDLE TASK
@@ -176,7 +602,7 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
                  "Idle Task",
                   OS_IdleTask,
                   DEF_NULL,
-                  15u,
+                  OS_CFG_PRIO_MAX - 1u,
                  &OSCfg_IdleTaskStk[0],
                   OS_CFG_IDLE_TASK_STK_SIZE / 10,
                   OS_CFG_IDLE_TASK_STK_SIZE,
@@ -202,12 +628,326 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS HW-RTOS and your application MUST NOT call it.
+*
+*              2) The idle task frees the memory of the dynamic tasks that deleted themselves.  OSTaskDelDyn()
+*                 signals it through OSTaskDynReapCtr, the list is only walked when the count is not zero.
 *********************************************************************************************************
 */
 
 void  OS_IdleTask (void  *p_arg)
 {
     while (DEF_ON) {
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+        if (OSTaskDynReapCtr != 0u) {
+            OS_TaskDynReap();
+        }
+#endif
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DISABLE HWOS DISPATCHING
+*
+* Description: This function prevents the HWOS from requesting context switches until the matching call to
+*              OS_DispatchEn().  Calls can be nested, only the outermost call issues the HWOS command.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) While dispatching is disabled, the HWOS keeps the current context running.  Commands issued
+*                 in that window can be completed with OS_HWOS_CMD_WAIT() since they never request a switch.
+*********************************************************************************************************
+*/
+
+void  OS_DispatchDis (void)
+{
+    CPU_INT32U  resp;
+
+
+    if (OSDispatchDisCtr == 0u) {
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_DIS_DSP);
+
+        OS_HWOS_CMD_WAIT(resp);
+        (void)&resp;
+    }
+
+    OSDispatchDisCtr++;
+}
 
+
+/*
+*********************************************************************************************************
+*                                       ENABLE HWOS DISPATCHING
+*
+* Description: This function undoes one call to OS_DispatchDis().  When the outermost call is undone, the
+*              HWOS re-evaluates the ready list and requests a single context switch if a higher priority
+*              task was readied while dispatching was disabled.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) When sub-priorities are enabled, the tasks readied while dispatching was disabled are
+*                 ordered within their band before dispatching is enabled again.  Only the tasks that may
+*                 have changed state are looked at and the bands are only re-queued when a task joined them
+*                 out of order (see 'os_prio.c  Note #3').
+*********************************************************************************************************
+*/
+
+void  OS_DispatchEn (void)
+{
+    CPU_INT32U  ret_val;
+
+
+    if (OSDispatchDisCtr == 0u) {
+        return;
+    }
+
+    OSDispatchDisCtr--;
+    if (OSDispatchDisCtr == 0u) {
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+        OS_PrioSched();                                         /* Order the bands before the HWOS dispatches.          */
+#endif
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_ENA_DSP);
+
+        OS_HWOS_CMD_PROC_ISR(ret_val);                          /* Pends the switch to the new context, if any.         */
+        (void)&ret_val;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DEFER THE CONTEXT SWITCH
+*
+* Description: This function holds back the context switches requested by the HWOS until OS_SchedFlush() is
+*              called.  It is used by the posts made with OS_OPT_POST_NO_SCHED.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) This function has no effect in an ISR, the switch will be performed on exit.
+*
+*              4) The switch is held until the next call to the kernel made by the task, see
+*                 'os.h  DEFERRED CONTEXT SWITCH MACROS  Note #1'.
+*********************************************************************************************************
+*/
+
+void  OS_SchedDefer (void)
+{
+    if (OSIntNestingCtr > 0u) {
+        return;
     }
+
+    if (OSSchedDeferred == OS_SCHED_DEFER_NONE) {
+        OS_DispatchDis();
+    }
+    OSSchedDeferred = OS_SCHED_DEFER_POST;                      /* See Note #4.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                  PERFORM THE DEFERRED CONTEXT SWITCH
+*
+* Description: This function performs the context switch held back by OS_SchedDefer(), if any.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called from a task with interrupts enabled.  The HWOS considers the
+*                 new task as running once it requests the switch, so no command must be issued on behalf
+*                 of the calling task in the same critical section.
+*********************************************************************************************************
+*/
+
+void  OS_SchedFlush (void)
+{
+    CPU_SR_ALLOC();
+
+
+    if (OSSchedDeferred == OS_SCHED_DEFER_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OSSchedDeferred = OS_SCHED_DEFER_NONE;
+    OS_DispatchEn();
+    CPU_CRITICAL_EXIT();
+    OS_HWOS_TASK_SYNC();
+}
+
+
+/*
+*********************************************************************************************************
+*                                COMPLETE THE OUTSTANDING ASYNCHRONOUS POST
+*
+* Description: This function waits for the HWOS to complete the command issued by the last asynchronous post.  An
+*              error is kept in the TCB of the task that made the post, until it calls OSPostAsyncCollect().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.  It is
+*                 called through OS_HWOS_CMD_SYNC(), before the registers of the next HWOS command are written.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) The post was made with HWOS dispatching disabled, its command never requests a switch.
+*
+*              4) The object was valid when the post was made, an invalid ID means that it was deleted before
+*                 the HWOS processed the command.  This is an error of the application, it is kept in the TCB
+*                 like the other errors.  Only an invalid system call, which the kernel never issues, raises
+*                 an exception.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+void  OS_PostAsyncCollect (void)
+{
+    CPU_INT32U   resp;
+    OS_TCB      *p_tcb;
+    OS_ERR       err;
+
+
+    OSPostAsyncPend = DEF_NO;
+
+    OS_HWOS_CMD_WAIT(resp);                                     /* See Note #3.                                         */
+
+    if (resp == 0x0001u) {                                      /* Success.                                             */
+        return;
+    }
+
+    if ((OSPostAsyncCmd == OS_HWOS_TSFNC_SIG_SEM) && (resp == 0xFF8Fu)) {
+        err = OS_ERR_SEM_OVF;                                   /* Semaphore overflow.                                  */
+    } else if ((OSPostAsyncCmd == OS_HWOS_TSFNC_SND_MBX) && (resp == 0x0084u)) {
+        err = OS_ERR_Q_FULL;                                    /* Mail box overflow.                                   */
+    } else if ((OSPostAsyncCmd == OS_HWOS_TSFNC_SND_MBX) && (resp == 0xFF85u)) {
+        err = OS_ERR_OBJ_DEL;                                   /* Invalid ID, see Note #4.                             */
+    } else if (resp == 0xFF84u) {
+        err = OS_ERR_OBJ_DEL;                                   /* Invalid semaphore or group ID, see Note #4.          */
+    } else {
+        CPU_SW_EXCEPTION(;);                                    /* Invalid system call.                                 */
+    }
+
+    if (OSPostAsyncCtxID < OS_HWOS_CNTX_CNT) {
+        p_tcb = OSTaskTCBPtrTbl[OSPostAsyncCtxID];
+        if ((p_tcb != DEF_NULL) && (p_tcb->PostAsyncErr == OS_ERR_NONE)) {
+            p_tcb->PostAsyncErr = err;                          /* Keep the first error.                                */
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      RUN ROUND-ROBIN SCHEDULING
+*
+* Description: This function is called on every OS tick to count down the time slice of the running task.
+*              When the time slice expires, the ready queue of the task's priority is rotated so that the
+*              next ready task at the same priority runs.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called from the OS tick ISR, between OSIntEnter() and OSIntExit().
+*
+*              3) The ready queue is only rotated when a time slice expires, not on every tick.  The time
+*                 slice is not counted while the scheduler is locked.
+*
+*              4) When sub-priorities are enabled, the band is shared by several logical priorities.  The task
+*                 is then moved behind the ready tasks of its own logical priority instead of rotating the band.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void  OS_SchedRoundRobin (void)
+{
+    OS_TCB      *p_tcb;
+#if (OS_PRIO_SUB_EN == DEF_DISABLED)
+    CPU_INT32U   ret_val;
+#endif
+    CPU_SR_ALLOC();
+
+
+    if (OSSchedRoundRobinEn != DEF_ENABLED) {                   /* Make sure round-robin has been enabled               */
+        return;
+    }
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't round-robin if the scheduler is locked         */
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OSCtxIDCur >= OS_HWOS_CNTX_CNT) {                       /* Multitasking not started yet.                        */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    p_tcb = OSTaskTCBPtrTbl[OSCtxIDCur];
+    if ((p_tcb == DEF_NULL) ||
+        (p_tcb == &OSIdleTaskTCB)) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if (p_tcb->TimeQuantaCtr > 0u) {
+        p_tcb->TimeQuantaCtr--;
+    }
+
+    if (p_tcb->TimeQuantaCtr > 0u) {                            /* Task has not used up its time slice                  */
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    if (p_tcb->TimeQuanta == 0u) {                              /* See if we need to use the default time slice         */
+        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
+    } else {
+        p_tcb->TimeQuantaCtr = p_tcb->TimeQuanta;               /* Load time slice counter with new time                */
+    }
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    OS_DispatchDis();                                           /* Move the task behind its logical priority peers.     */
+    (void)OS_PrioYield(p_tcb);
+    OS_DispatchEn();                                            /* Switch happens on exit from the tick ISR.            */
+#else
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(OS_PRIO_TO_HW(p_tcb->Prio));                 /* Priority of the ready queue to rotate.               */
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_ROT_RDQ);
+
+    OS_HWOS_CMD_PROC_ISR(ret_val);                              /* Switch happens on exit from the tick ISR.            */
+    (void)&ret_val;
+#endif
+
+    CPU_CRITICAL_EXIT();
 }
+#endif
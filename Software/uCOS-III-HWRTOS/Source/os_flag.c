@@ -131,6 +131,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     }
 
     p_grp->GrpID = grp_id;
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatClr(&p_grp->Stat);
+#endif
     OSGrpPtrTbl[i] = p_grp;
     RIN32_HWOS->FLG_TBL[p_grp->GrpID] = 0u;
 
@@ -139,6 +142,7 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
 #endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(grp_id | DEF_BIT_16);                        /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CRE_G);
 
@@ -230,6 +234,10 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
                       OS_ERR       *p_err)
 {
     CPU_INT32U  r6_temp;
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    CPU_TS       ts_start;
+    CPU_BOOLEAN  blocked;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -296,14 +304,22 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
 
     if (opt & OS_OPT_PEND_NON_BLOCKING) {
         timeout = 0u;
+    } else if (OSSchedLockNestingCtr > 0u) {
+        timeout = 0u;                                           /* Can't block while the scheduler is locked.           */
+    } else {
+        OS_SchedFlush();                                        /* Release a deferred switch before blocking.           */
     }
 
     r6_temp  = (opt & OS_OPT_PEND_FLAG_CONSUME) ? DEF_BIT_00 : 0u;
     r6_temp |= (opt & OS_OPT_PEND_FLAG_SET_ALL) ? DEF_BIT_01 : 0u;
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    ts_start = CPU_TS_Get32();
+#endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_grp->GrpID);                               /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_R5(timeout);                                    /* Timeout.                                             */
     OS_HWOS_SET_R6(r6_temp);                                    /* Pend options.                                        */
@@ -314,9 +330,16 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
 
     OS_HWOS_CMD_PROC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    blocked = OS_ObjStatPend(&p_grp->Stat);                     /* Count the pend before the task is switched out.      */
+#endif
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatPendEnd(&p_grp->Stat, blocked, ts_start, OSTaskRet[OSCtxIDCur].r0 & OS_HWOS_RESP_MASK);
+#endif
+
     switch (OSTaskRet[OSCtxIDCur].r0) {
         case 0x0001:                                            /* Success.                                             */
         case 0x0003:                                            /* Success.                                             */
@@ -324,8 +347,12 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
              break;
 
         case 0x0004:                                            /* Would block.                                         */
-             *p_err = OS_ERR_PEND_WOULD_BLOCK;
-              break;
+             if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+                *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             } else {
+                *p_err = OS_ERR_SCHED_LOCKED;                   /* Polled since the scheduler is locked.                */
+             }
+             break;
 
         case 0xFF86:                                            /* Timeout.                                             */
             *p_err = OS_ERR_TIMEOUT;
@@ -380,6 +407,9 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
 *                            OS_OPT_POST_FLAG_CLR       cleared
 *
 *                            you can also 'add' OS_OPT_POST_NO_SCHED to prevent the scheduler from being called.
+*                            The context switch is then held until OSSched() is called, the calling task
+*                            blocks, or it calls the kernel for anything else than another post with that
+*                            option.  The option is ignored when posting from an ISR.
 *
 *              p_err         is a pointer to an error code and can be:
 *
@@ -434,8 +464,15 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 
 
     CPU_CRITICAL_ENTER();
+    OS_PRIO_SCHED_ENTER();                                      /* Order the readied tasks before dispatching them.     */
+    OS_OBJ_STAT_POST(p_grp);
+
+    if ((opt & OS_OPT_POST_NO_SCHED) != 0u) {
+        OS_SchedDefer();                                        /* Hold the switch for the posting sequence.            */
+    }
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_grp->GrpID);                               /* HWOS Group ID.                                       */
     OS_HWOS_SET_R5(flags);                                      /* Flag pattern.                                        */
 
@@ -447,6 +484,7 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 
     OS_HWOS_CMD_PROC_ISR(ret_val);
 
+    OS_PRIO_SCHED_EXIT(ret_val);
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
@@ -474,6 +512,112 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 }
 
 
+/*
+*********************************************************************************************************
+*                                POST EVENT FLAG BITS ASYNCHRONOUSLY
+*
+* Description: This function sets or clears event flag bits without waiting for the HWOS to complete the post.
+*              The caller keeps running while the HWOS processes the command.
+*
+* Arguments  : p_grp         is a pointer to the desired event flag group.
+*
+*              flags         indicates the bits to set or clear, see OSFlagPost().
+*
+*              opt           indicates whether the flags will be:
+*
+*                            OS_OPT_POST_FLAG_SET       set
+*                            OS_OPT_POST_FLAG_CLR       cleared
+*
+*              p_err         is a pointer to an error code and can be:
+*
+*                            OS_ERR_NONE                The post was issued
+*                            OS_ERR_OBJ_PTR_NULL        You passed a NULL pointer
+*                            OS_ERR_OBJ_TYPE            You are not pointing to an event flag group
+*                            OS_ERR_OPT_INVALID         You specified an invalid option
+*                            OS_ERR_POST_ISR            You called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) The result of the post is collected by the next HWOS command, see OS_PostAsyncCollect().  A
+*                 post to a deleted group is reported by the next call to OSPostAsyncCollect().
+*
+*              2) The context switch is held while the HWOS processes the post, and only until the next call to
+*                 the kernel made by the calling task, which also collects the result.  OSSched(),
+*                 OSPostAsyncCollect() or blocking release it as well.
+*********************************************************************************************************
+*/
+
+#if ((OS_CFG_FLAG_EN == DEF_ENABLED) && (OS_CFG_POST_ASYNC_EN == DEF_ENABLED))
+void  OSFlagPostAsync (OS_FLAG_GRP  *p_grp,
+                       OS_FLAGS      flags,
+                       OS_OPT        opt,
+                       OS_ERR       *p_err)
+{
+    CPU_INT32U  cmd;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_grp == DEF_NULL) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FLAG_SET:
+        case OS_OPT_POST_FLAG_CLR:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {                      /* Make sure the flag was created                       */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (opt & OS_OPT_POST_FLAG_CLR) {
+        cmd = OS_HWOS_TSFNC_CLR_G;
+    } else {
+        cmd = OS_HWOS_TSFNC_SET_G;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_SchedDefer();                                            /* Hold the switch, see Note #2.                        */
+    OS_OBJ_STAT_POST(p_grp);
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(p_grp->GrpID);                               /* HWOS Group ID.                                       */
+    OS_HWOS_SET_R5(flags);                                      /* Flag pattern.                                        */
+    OS_HWOS_SET_SYSC(cmd);
+
+    OSPostAsyncCtxID = OSCtxIDCur;                              /* Don't wait for the result, see Note #1.              */
+    OSPostAsyncCmd   = cmd;
+    OSPostAsyncPend  = DEF_YES;
+    CPU_CRITICAL_EXIT();
+    OS_SCHED_DEFER_CHK();                                       /* Release the switch on the next call, see Note #2.    */
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                     DELETE AN EVENT FLAG GROUP
@@ -550,6 +694,7 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
 
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_grp->GrpID);
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_DEL_G);
 
@@ -30,6 +30,10 @@
 * Filename      : os_hwisr.c
 * Version       : V1.00.00
 * Programmer(s) : JBL
+*
+* Note(s)       : (1) OSInit() maps QINT signal 'n' onto HW ISR operation slot 'n' (see HWISR_PNTR[]), so each
+*                     of the OS_HWOS_HWISR_CNT QINT signals owns its own HWISP_OPR[] slot.  A QINT signal is
+*                     free when both its operation slot and its QINTSEL[] entry are cleared.
 *********************************************************************************************************
 */
 
@@ -43,6 +47,34 @@
 #include  "os.h"
 
 
+/*
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  os_hwisr_action_info {
+    CPU_INT32U   Type;                                          /* HWOS HW ISR operation type.                          */
+    OS_OBJ_TYPE  ObjType;                                       /* Type of the object the action applies to.            */
+    CPU_BOOLEAN  ParamEn;                                       /* DEF_YES if 'param' is used by the action.            */
+    CPU_INT32U   ParamDflt;                                     /* Operation parameter used otherwise.                  */
+} OS_HWISR_ACTION_INFO;
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL TABLES
+*********************************************************************************************************
+*/
+
+static  const  OS_HWISR_ACTION_INFO  OS_HWISRActionInfoTbl[OS_HWISR_ACTION_NBR] = {
+    { OS_HWOS_HWISR_TYPE_SIG_SEM,  OS_OBJ_TYPE_SEM,  DEF_NO,  7u }, /* OS_HWISR_ACTION_SEM_POST                         */
+    { OS_HWOS_HWISR_TYPE_SET_FLAG, OS_OBJ_TYPE_FLAG, DEF_YES, 0u }, /* OS_HWISR_ACTION_FLAG_POST                        */
+    { OS_HWOS_HWISR_TYPE_WUP_TSK,  OS_OBJ_TYPE_TASK, DEF_NO,  7u }, /* OS_HWISR_ACTION_TASK_RESUME                      */
+    { OS_HWOS_HWISR_TYPE_REL_WAI,  OS_OBJ_TYPE_TASK, DEF_NO,  7u }  /* OS_HWISR_ACTION_PEND_ABORT                       */
+};
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -54,13 +86,24 @@
 
 /*
 *********************************************************************************************************
-*                                       SET A SEMAPHORE POST HW ISR
+*                                           CONFIGURE A HW ISR
 *
-* Description: Configure an hardware ISR to perform a semaphore post.
+* Description: Configure an hardware ISR to perform a kernel action when an interrupt occurs.
 *
-* Arguments  : p_sem         Pointer to the semaphore.
+* Arguments  : qint_id       QINT signal to configure (0-31).
 *
-*              qint_id       QINT signal to configure (0-31).
+*              int_id        Interrupt signal assigned to the QINT signal (0-255).
+*
+*              action        Action performed by the HW ISR:
+*
+*                            OS_HWISR_ACTION_SEM_POST     Post the semaphore 'p_obj'.
+*                            OS_HWISR_ACTION_FLAG_POST    Set the flags 'param' of the flag group 'p_obj'.
+*                            OS_HWISR_ACTION_TASK_RESUME  Wake up the task 'p_obj' from OSTimeDly().
+*                            OS_HWISR_ACTION_PEND_ABORT   Abort the pend of the task 'p_obj'.
+*
+*              p_obj         Pointer to the object the action applies to.
+*
+*              param         Flags to set for OS_HWISR_ACTION_FLAG_POST, ignored otherwise.
 *
 *              opt           Determine whether to enable the HW ISR before returning. HW ISR are enabled
 *                            by default.
@@ -73,23 +116,31 @@
 *
 *                            OS_ERR_NONE                  The call was successful.
 *                            OS_ERR_CREATE_ISR            Can't configure an HW-ISR from an ISR.
-*                            OS_ERR_OBJ_PTR_NULL          p_sem is Null.
+*                            OS_ERR_OBJ_PTR_NULL          p_obj is NULL.
 *                            OS_ERR_HWOS_QINT_ID_INVALID  Invalid QUINT signal id.
 *                            OS_ERR_HWOS_INT_ID_INVALID   Invalid interrupt id.
-*                            OS_ERR_OPT_INVALID           Invalid options.
-*                            OS_ERR_OBJ_TYPE              p_sem does not point to a semaphore.
+*                            OS_ERR_OPT_INVALID           Invalid options or action.
+*                            OS_ERR_OBJ_TYPE              p_obj does not point to an object of the action's type.
 *                            OS_ERR_HWOS_QINT_CFG         QINT signal id is already configured.
 *
 * Returns    : none
+*
+* Note(s)    : 1) Each QINT signal has its own operation slot, so all the QINT signals can be configured at
+*                 the same time.  See OSHWISRFreeGet() to find the free ones.
 *********************************************************************************************************
 */
 
-void  OSHWISRSemPostSet (OS_SEM       *p_sem,
-                         OS_QINT_ID    qint_id,
-                         OS_INT_ID     int_id,
-                         OS_OPT        opt,
-                         OS_ERR       *p_err)
+void  OSHWISRSet (OS_QINT_ID        qint_id,
+                  OS_INT_ID         int_id,
+                  OS_HWISR_ACTION   action,
+                  void             *p_obj,
+                  CPU_INT32U        param,
+                  OS_OPT            opt,
+                  OS_ERR           *p_err)
 {
+    const  OS_HWISR_ACTION_INFO  *p_info;
+           CPU_INT32U             obj_id;
+           CPU_INT32U             opr_param;
     CPU_SR_ALLOC();
 
 
@@ -106,17 +157,17 @@ void  OSHWISRSemPostSet (OS_SEM       *p_sem,
         CPU_SW_EXCEPTION(;);
     }
 
-    if (p_sem == DEF_NULL) {                                    /* Validate p_sem.                                      */
+    if (p_obj == DEF_NULL) {                                    /* Validate p_obj.                                      */
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
 
-    if (qint_id > OS_HWOS_HWISR_CNT) {                          /* Validate QINT ID.                                     */
-       *p_err = OS_ERR_HWOS_QINT_ID_INVALID;                    /* Validate ISR ID.                                      */
+    if (qint_id >= OS_HWOS_HWISR_CNT) {                         /* Validate QINT ID.                                    */
+       *p_err = OS_ERR_HWOS_QINT_ID_INVALID;
         return;
     }
 
-    if (int_id > 255u) {
+    if (int_id > 255u) {                                        /* Validate ISR ID.                                     */
        *p_err = OS_ERR_HWOS_INT_ID_INVALID;
         return;
     }
@@ -132,18 +183,57 @@ void  OSHWISRSemPostSet (OS_SEM       *p_sem,
     }
 #endif
 
-
-#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
-    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Check the object type.                               */
-       *p_err = OS_ERR_OBJ_TYPE;
+    if (action >= OS_HWISR_ACTION_NBR) {                        /* Validate 'action'                                    */
+       *p_err = OS_ERR_OPT_INVALID;
         return;
     }
+
+    p_info = &OS_HWISRActionInfoTbl[action];
+
+    switch (action) {                                           /* Get the HWOS id of the object.                       */
+        case OS_HWISR_ACTION_SEM_POST:
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+             if (((OS_SEM *)p_obj)->Type != p_info->ObjType) {
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return;
+             }
 #endif
+             obj_id = ((OS_SEM *)p_obj)->SemID;
+             break;
+
+        case OS_HWISR_ACTION_FLAG_POST:
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+             if (((OS_FLAG_GRP *)p_obj)->Type != p_info->ObjType) {
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return;
+             }
+#endif
+             obj_id = ((OS_FLAG_GRP *)p_obj)->GrpID;
+             break;
+
+        case OS_HWISR_ACTION_TASK_RESUME:
+        case OS_HWISR_ACTION_PEND_ABORT:
+        default:
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+             if (((OS_TCB *)p_obj)->Type != p_info->ObjType) {
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return;
+             }
+#endif
+             obj_id = ((OS_TCB *)p_obj)->CtxID;
+             break;
+    }
+
+    if (p_info->ParamEn == DEF_YES) {
+        opr_param = param;
+    } else {
+        opr_param = p_info->ParamDflt;
+    }
 
     CPU_CRITICAL_ENTER();
 
-    if (RIN32_HWOS->HWISR.HWISP_OPR[qint_id] != 0u &&
-        RIN32_HWOS->QINTSEL[qint_id]         != 0u) {           /* QINT must be cleared.                                */
+    if ((RIN32_HWOS->HWISR.HWISP_OPR[qint_id] != 0u) ||
+        (RIN32_HWOS->QINTSEL[qint_id]         != 0u)) {         /* QINT must be cleared.                                */
        *p_err = OS_ERR_HWOS_QINT_CFG;
         CPU_CRITICAL_EXIT();
         return;
@@ -159,9 +249,9 @@ void  OSHWISRSemPostSet (OS_SEM       *p_sem,
     RIN32_HWOS->QINTSEL[qint_id] = int_id | 0x80;               /* Configure assigned ISR.                              */
 
                                                                 /* Configure QINT operation.                            */
-    RIN32_HWOS->HWISR.HWISP_OPR[0]  = (OS_HWOS_HWISR_TYPE_SIG_SEM << 24) |
-                                      (p_sem->SemID)                     |
-                                      (7 << 8);
+    RIN32_HWOS->HWISR.HWISP_OPR[qint_id] = (p_info->Type << 24) |
+                                           (obj_id)             |
+                                           (opr_param << 8);
 
     if ((opt & OS_OPT_QINT_DISABLED) == 0u) {
         RIN32_HWOS->HWISR.QINT |= 1u << qint_id;                /* Enable QINT.                                         */
@@ -173,6 +263,99 @@ void  OSHWISRSemPostSet (OS_SEM       *p_sem,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        GET THE FREE HW ISRs
+*
+* Description: Return the QINT signals that are not configured.
+*
+* Arguments  : p_err         is a pointer to a variable that will contain an error code returned by this
+*                            function.
+*
+*                            OS_ERR_NONE                  The call was successful.
+*
+* Returns    : A bitmap of the free QINT signals, bit 'n' being set when QINT signal 'n' is free.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  OSHWISRFreeGet (OS_ERR  *p_err)
+{
+    CPU_INT32U  free_map;
+    CPU_INT32U  qint_id;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(0u);
+    }
+#endif
+
+    free_map = 0u;
+
+    CPU_CRITICAL_ENTER();
+    for (qint_id = 0u; qint_id < OS_HWOS_HWISR_CNT; qint_id++) {
+        if ((RIN32_HWOS->HWISR.HWISP_OPR[qint_id] == 0u) &&
+            (RIN32_HWOS->QINTSEL[qint_id]         == 0u)) {
+            free_map |= 1u << qint_id;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+
+    return (free_map);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       SET A SEMAPHORE POST HW ISR
+*
+* Description: Configure an hardware ISR to perform a semaphore post.
+*
+* Arguments  : p_sem         Pointer to the semaphore.
+*
+*              qint_id       QINT signal to configure (0-31).
+*
+*              opt           Determine whether to enable the HW ISR before returning. HW ISR are enabled
+*                            by default.
+*
+*                            OS_OPT_QINT_ENABLED
+*                            OS_OPT_QINT_DISABLED
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this
+*                            function.
+*
+*                            OS_ERR_NONE                  The call was successful.
+*                            OS_ERR_CREATE_ISR            Can't configure an HW-ISR from an ISR.
+*                            OS_ERR_OBJ_PTR_NULL          p_sem is Null.
+*                            OS_ERR_HWOS_QINT_ID_INVALID  Invalid QUINT signal id.
+*                            OS_ERR_HWOS_INT_ID_INVALID   Invalid interrupt id.
+*                            OS_ERR_OPT_INVALID           Invalid options.
+*                            OS_ERR_OBJ_TYPE              p_sem does not point to a semaphore.
+*                            OS_ERR_HWOS_QINT_CFG         QINT signal id is already configured.
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+void  OSHWISRSemPostSet (OS_SEM       *p_sem,
+                         OS_QINT_ID    qint_id,
+                         OS_INT_ID     int_id,
+                         OS_OPT        opt,
+                         OS_ERR       *p_err)
+{
+    OSHWISRSet(qint_id,
+               int_id,
+               OS_HWISR_ACTION_SEM_POST,
+               p_sem,
+               0u,
+               opt,
+               p_err);
+}
+
+
 /*
 *********************************************************************************************************
 *                                         SET A FLAG POST HW ISR
@@ -214,87 +397,13 @@ void  OSHWISRFlagPostSet (OS_FLAG_GRP  *p_grp,
                           OS_OPT        opt,
                           OS_ERR       *p_err)
 {
-    CPU_SR_ALLOC();
-
-
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
-       *p_err = OS_ERR_CREATE_ISR;
-        return;
-    }
-#endif
-
-
-#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
-        CPU_SW_EXCEPTION(;);
-    }
-
-    if (p_grp == DEF_NULL) {                                    /* Validate p_grp.                                       */
-       *p_err = OS_ERR_OBJ_PTR_NULL;
-        return;
-    }
-
-    if (qint_id > OS_HWOS_HWISR_CNT) {                          /* Validate QINT ID.                                     */
-       *p_err = OS_ERR_HWOS_QINT_ID_INVALID;                    /* Validate ISR ID.                                      */
-        return;
-    }
-
-    if (int_id > 255u) {
-       *p_err = OS_ERR_HWOS_INT_ID_INVALID;
-        return;
-    }
-
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_QINT_ENABLED:
-        case OS_OPT_QINT_DISABLED:
-             break;
-
-        default:
-            *p_err = OS_ERR_OPT_INVALID;
-             return;
-    }
-#endif
-
-
-#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
-    if (p_grp->Type != OS_OBJ_TYPE_FLAG) {                      /* Check the object type.                               */
-       *p_err = OS_ERR_OBJ_TYPE;
-        return;
-    }
-#endif
-
-
-    CPU_CRITICAL_ENTER();
-
-    if (RIN32_HWOS->HWISR.HWISP_OPR[qint_id] != 0u &&
-        RIN32_HWOS->QINTSEL[qint_id]         != 0u) {           /* QINT must be cleared.                                */
-       *p_err = OS_ERR_HWOS_QINT_CFG;
-        CPU_CRITICAL_EXIT();
-        return;
-    }
-
-    if ((RIN32_HWOS->HWISR.QINT & (1u << qint_id)) != 0u) {     /* QINT must be disabled.                               */
-       *p_err = OS_ERR_HWOS_QINT_CFG;
-        CPU_CRITICAL_EXIT();
-        return;
-    }
-
-
-    RIN32_HWOS->QINTSEL[qint_id] = int_id | 0x80;               /* Configure assigned ISR.                              */
-
-                                                                /* Configure QINT operation.                            */
-    RIN32_HWOS->HWISR.HWISP_OPR[0]  = (OS_HWOS_HWISR_TYPE_SET_FLAG << 24) |
-                                      (p_grp->GrpID)                      |
-                                      (flags << 8);
-
-    if ((opt & OS_OPT_QINT_DISABLED) == 0u) {
-        RIN32_HWOS->HWISR.QINT |= 1u << qint_id;                /* Enable QINT.                                         */
-    }
-
-    CPU_CRITICAL_EXIT();
-
-   *p_err = OS_ERR_NONE;
+    OSHWISRSet(qint_id,
+               int_id,
+               OS_HWISR_ACTION_FLAG_POST,
+               p_grp,
+               flags,
+               opt,
+               p_err);
 }
 
 
@@ -327,6 +436,9 @@ void  OSHWISRFlagPostSet (OS_FLAG_GRP  *p_grp,
 *                            OS_ERR_HWOS_QINT_CFG         QINT signal id is already configured.
 *
 * Returns    : none
+*
+* Note(s)    : 1) The HW ISR wakes up the task from OSTimeDly().  It does not undo OSTaskSuspend(), which can
+*                 only be undone by OSTaskResume().
 *********************************************************************************************************
 */
 
@@ -336,15 +448,74 @@ void  OSHWISRTaskResumeSet (OS_TCB       *p_tcb,
                             OS_OPT        opt,
                             OS_ERR       *p_err)
 {
-    CPU_SR_ALLOC();
+    OSHWISRSet(qint_id,
+               int_id,
+               OS_HWISR_ACTION_TASK_RESUME,
+               p_tcb,
+               0u,
+               opt,
+               p_err);
+}
 
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
-       *p_err = OS_ERR_CREATE_ISR;
-        return;
-    }
-#endif
+/*
+*********************************************************************************************************
+*                                    SET A DESCRIPTOR RING HW ISR
+*
+* Description: Register a descriptor ring for a QINT signal and configure the HW ISR to post a semaphore.
+*              The ISR of the peripheral only puts the descriptor in the ring with OSHWISRQPost(), and the
+*              HW ISR signals the consumer, so the receive path makes no kernel call in interrupt context.
+*
+* Arguments  : p_q           Pointer to the descriptor ring.
+*
+*              p_slot_tbl    Pointer to the slots of the ring.
+*
+*              size          Number of slots, MUST be a power of 2.
+*
+*              p_sem         Pointer to the semaphore posted by the HW ISR.
+*
+*              qint_id       QINT signal to configure (0-31).
+*
+*              int_id        Interrupt signal assigned to the QINT signal (0-255).
+*
+*              opt           Determine whether to enable the HW ISR before returning. HW ISR are enabled
+*                            by default.
+*
+*                            OS_OPT_QINT_ENABLED
+*                            OS_OPT_QINT_DISABLED
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this
+*                            function.
+*
+*                            OS_ERR_NONE                  The call was successful.
+*                            OS_ERR_OBJ_PTR_NULL          p_q or p_slot_tbl is NULL.
+*                            OS_ERR_Q_SIZE                'size' is not a power of 2.
+*                            OS_ERR_HWOS_QINT_CFG         QINT signal id is already configured.
+*                            Other                        Other OS_ERR_xxx returned by OSHWISRSet().
+*
+* Returns    : none
+*
+* Note(s)    : 1) The ISR of the peripheral and the HW ISR are triggered by the same interrupt signal.  The
+*                 consumer only runs once the ISR returned, since the context switch is done by PendSV at
+*                 the lowest exception priority, so the descriptor is always in the ring when the consumer
+*                 is woken up.
+*
+*              2) The ring has a single producer, the ISR of 'qint_id', and a single consumer task.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+void  OSHWISRQSet (OS_HWISR_Q   *p_q,
+                   void        **p_slot_tbl,
+                   CPU_INT32U    size,
+                   OS_SEM       *p_sem,
+                   OS_QINT_ID    qint_id,
+                   OS_INT_ID     int_id,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    CPU_INT32U  i;
+    CPU_SR_ALLOC();
 
 
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
@@ -352,72 +523,176 @@ void  OSHWISRTaskResumeSet (OS_TCB       *p_tcb,
         CPU_SW_EXCEPTION(;);
     }
 
-    if (p_tcb == DEF_NULL) {                                    /* Validate p_tcb.                                      */
+    if ((p_q == DEF_NULL) || (p_slot_tbl == DEF_NULL)) {
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
 
-    if (qint_id > OS_HWOS_HWISR_CNT) {                          /* Validate QINT ID.                                     */
-       *p_err = OS_ERR_HWOS_QINT_ID_INVALID;                    /* Validate ISR ID.                                      */
+    if (qint_id >= OS_HWOS_HWISR_CNT) {                         /* Validate QINT ID.                                    */
+       *p_err = OS_ERR_HWOS_QINT_ID_INVALID;
         return;
     }
+#endif
 
-    if (int_id > 255u) {
-       *p_err = OS_ERR_HWOS_INT_ID_INVALID;
+    if ((size < 2u) || ((size & (size - 1u)) != 0u)) {
+       *p_err = OS_ERR_Q_SIZE;
         return;
     }
 
-    switch (opt) {                                              /* Validate 'opt'                                       */
-        case OS_OPT_QINT_ENABLED:
-        case OS_OPT_QINT_DISABLED:
-             break;
-
-        default:
-            *p_err = OS_ERR_OPT_INVALID;
-             return;
+    for (i = 0u; i < size; i++) {
+        p_slot_tbl[i] = DEF_NULL;
     }
-#endif
 
+    p_q->SlotTbl = p_slot_tbl;
+    p_q->Mask    = size - 1u;
+    p_q->InIx    = 0u;
+    p_q->OutIx   = 0u;
+    p_q->OvfCtr  = 0u;
+    p_q->SemPtr  = p_sem;
+    p_q->QIntID  = qint_id;
 
-#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
-    if (p_tcb->Type != OS_OBJ_TYPE_TASK) {                      /* Check the object type.                               */
-       *p_err = OS_ERR_OBJ_TYPE;
+    CPU_CRITICAL_ENTER();
+    if (OSHWISRQPtrTbl[qint_id] != DEF_NULL) {                  /* QINT must not have a ring yet.                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_HWOS_QINT_CFG;
         return;
     }
+    OSHWISRQPtrTbl[qint_id] = p_q;                              /* Register the ring before the QINT can fire.          */
+    CPU_CRITICAL_EXIT();
+
+    OSHWISRSet(qint_id,
+               int_id,
+               OS_HWISR_ACTION_SEM_POST,
+               p_sem,
+               0u,
+               opt,
+               p_err);
+    if (*p_err != OS_ERR_NONE) {
+        OSHWISRQPtrTbl[qint_id] = DEF_NULL;
+    }
+}
 #endif
 
 
-    CPU_CRITICAL_ENTER();
+/*
+*********************************************************************************************************
+*                                 POST A DESCRIPTOR TO A HW ISR RING
+*
+* Description: Put a descriptor in the ring registered for a QINT signal.  This function is meant to be the
+*              whole ISR of the peripheral: it only writes a slot and never calls the kernel.
+*
+* Arguments  : qint_id       QINT signal whose ring receives the descriptor.
+*
+*              p_desc        Pointer to the descriptor.
+*
+* Returns    : DEF_OK,   if the descriptor was queued.
+*              DEF_FAIL, if the ring is full (the overflow counter is incremented), not registered or if
+*                        'qint_id' is invalid.
+*
+* Note(s)    : 1) This function MUST only be called from the ISR of 'qint_id'.
+*
+*              2) The semaphore is posted by the HW ISR, not by this function.
+*********************************************************************************************************
+*/
 
-    if (RIN32_HWOS->HWISR.HWISP_OPR[qint_id] != 0u &&
-        RIN32_HWOS->QINTSEL[qint_id]         != 0u) {           /* QINT must be cleared.                                */
-       *p_err = OS_ERR_HWOS_QINT_CFG;
-        CPU_CRITICAL_EXIT();
-        return;
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+CPU_BOOLEAN  OSHWISRQPost (OS_QINT_ID   qint_id,
+                           void        *p_desc)
+{
+    OS_HWISR_Q  *p_q;
+    CPU_INT32U   in_ix;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (qint_id >= OS_HWOS_HWISR_CNT) {                         /* Validate QINT ID.                                    */
+        return (DEF_FAIL);
+    }
+#endif
+
+    p_q = OSHWISRQPtrTbl[qint_id];
+    if (p_q == DEF_NULL) {
+        return (DEF_FAIL);
     }
 
-    if ((RIN32_HWOS->HWISR.QINT & (1u << qint_id)) != 0u) {     /* QINT must be disabled.                               */
-       *p_err = OS_ERR_HWOS_QINT_CFG;
-        CPU_CRITICAL_EXIT();
-        return;
+    in_ix = p_q->InIx;
+    if ((in_ix - p_q->OutIx) > p_q->Mask) {                     /* Ring is full.                                        */
+        p_q->OvfCtr++;
+        return (DEF_FAIL);
     }
 
+    p_q->SlotTbl[in_ix & p_q->Mask] = p_desc;
+    p_q->InIx = in_ix + 1u;                                     /* Publish the descriptor.                              */
 
-    RIN32_HWOS->QINTSEL[qint_id] = int_id | 0x80;               /* Configure assigned ISR.                              */
+    return (DEF_OK);
+}
+#endif
 
-                                                                /* Configure QINT operation.                            */
-    RIN32_HWOS->HWISR.HWISP_OPR[0]  = (OS_HWOS_HWISR_TYPE_WUP_TSK << 24) |
-                                      (p_tcb->CtxID)                     |
-                                      (7 << 8);
 
-    if ((opt & OS_OPT_QINT_DISABLED) == 0u) {
-        RIN32_HWOS->HWISR.QINT |= 1u << qint_id;                /* Enable QINT.                                         */
+/*
+*********************************************************************************************************
+*                                PEND ON A DESCRIPTOR FROM A HW ISR RING
+*
+* Description: Wait for a descriptor posted to a ring registered with OSHWISRQSet().
+*
+* Arguments  : p_q           Pointer to the descriptor ring.
+*
+*              timeout       Optional timeout period (in clock ticks).  0 waits forever.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this
+*                            function.
+*
+*                            OS_ERR_NONE                  A descriptor was received.
+*                            OS_ERR_OBJ_PTR_NULL          p_q is NULL.
+*                            Other                        Other OS_ERR_xxx returned by OSSemPend().
+*
+* Returns    : A pointer to the descriptor, DEF_NULL upon error.
+*
+* Note(s)    : 1) The descriptors already in the ring are returned without pending on the semaphore.  The
+*                 semaphore may thus count more posts than there are descriptors, the extra posts only cause
+*                 an empty wake up.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+void  *OSHWISRQPend (OS_HWISR_Q  *p_q,
+                     OS_TICK      timeout,
+                     OS_ERR      *p_err)
+{
+    void        *p_desc;
+    CPU_INT32U   out_ix;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(DEF_NULL);
     }
 
-    CPU_CRITICAL_EXIT();
+    if (p_q == DEF_NULL) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (DEF_NULL);
+    }
+#endif
 
-   *p_err = OS_ERR_NONE;
+    while (DEF_ON) {
+        out_ix = p_q->OutIx;
+        if (out_ix != p_q->InIx) {                              /* Take the oldest descriptor.                          */
+            p_desc     = p_q->SlotTbl[out_ix & p_q->Mask];
+            p_q->OutIx = out_ix + 1u;
+           *p_err      = OS_ERR_NONE;
+            return (p_desc);
+        }
+
+        (void)OSSemPend(p_q->SemPtr,                            /* Wait for the HW ISR.                                 */
+                        timeout,
+                        OS_OPT_PEND_BLOCKING,
+                        DEF_NULL,
+                        p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return (DEF_NULL);
+        }
+    }
 }
+#endif
 
 
 /*
@@ -455,7 +730,7 @@ void  OSHWISREn (OS_QINT_ID   qint_id,
 
 
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    if (qint_id > OS_HWOS_HWISR_CNT) {                          /* Validate QINT ID.                                    */
+    if (qint_id >= OS_HWOS_HWISR_CNT) {                         /* Validate QINT ID.                                    */
        *p_err = OS_ERR_HWOS_QINT_ID_INVALID;                    /* Validate ISR ID.                                     */
         return;
     }
@@ -520,7 +795,7 @@ void  OSHWISRDis (OS_QINT_ID   qint_id,
 
 
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    if (qint_id > OS_HWOS_HWISR_CNT) {                          /* Validate QINT ID.                                    */
+    if (qint_id >= OS_HWOS_HWISR_CNT) {                         /* Validate QINT ID.                                    */
        *p_err = OS_ERR_HWOS_QINT_ID_INVALID;                    /* Validate ISR ID.                                     */
         return;
     }
@@ -540,7 +815,7 @@ void  OSHWISRDis (OS_QINT_ID   qint_id,
         return;
     }
 
-    RIN32_HWOS->HWISR.QINT &= ~(1u << qint_id);                 /* Enable QINT.                                         */
+    RIN32_HWOS->HWISR.QINT &= ~(1u << qint_id);                 /* Disable QINT.                                        */
 
     CPU_CRITICAL_EXIT();
 
@@ -582,7 +857,7 @@ void  OSHWISRClr (OS_QINT_ID   qint_id,
 
 
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
-    if (qint_id > OS_HWOS_HWISR_CNT) {                          /* Validate QINT ID.                                    */
+    if (qint_id >= OS_HWOS_HWISR_CNT) {                         /* Validate QINT ID.                                    */
        *p_err = OS_ERR_HWOS_QINT_ID_INVALID;                    /* Validate ISR ID.                                     */
         return;
     }
@@ -596,8 +871,9 @@ void  OSHWISRClr (OS_QINT_ID   qint_id,
 
     RIN32_HWOS->QINTSEL[qint_id] = 0u;                          /* Clear assigned ISR.                                  */
 
-    RIN32_HWOS->HWISR.HWISP_OPR[0]  = 0u;                       /* Clear QINT operation.                                */
+    RIN32_HWOS->HWISR.HWISP_OPR[qint_id] = 0u;                  /* Clear QINT operation.                                */
 
+    OSHWISRQPtrTbl[qint_id] = DEF_NULL;                         /* Unregister the descriptor ring, if any.              */
 
     CPU_CRITICAL_EXIT();
 
@@ -30,14 +30,91 @@
 * Filename      : os_mem.c
 * Version       : V1.00.00
 * Programmer(s) : JBL
+*
+* Note(s)       : (1) The free blocks are linked through their first word.  OSMemGet() and OSMemPut() pop and
+*                     push them with a single exclusive load/store of the list head, so they never mask
+*                     interrupts and can be called from ISRs.
+*
+*                 (2) NbrFree is updated separately from the list, with OS_CPU_CmpSwap().  It is exact when no
+*                     get or put is in progress.  A put reserves its slot in NbrFree before pushing the block,
+*                     so returning more blocks than were taken is still detected.
+*
+*                 (3) A partition given a magazine table with OSMemMagSet() serves the tasks from a per context
+*                     magazine first, see os.h MEMORY PARTITIONS Note #2.  A magazine is only ever used by the
+*                     task running in its context, so it needs no protection at all.  ISRs, which must bracket
+*                     their code with OSIntEnter()/OSIntExit(), always use the free list.
+*
+*                     The blocks held in a magazine are not counted in NbrFree.  They are returned to the free
+*                     list by OSMemMagFlush() or as the magazine overflows, and a block freed twice is only
+*                     reported, as OS_ERR_MEM_FULL, when it reaches the free list.  The magazine of a deleted
+*                     task is inherited by the next task created in the same context.
+*
+*                 (4) OSMemPend() registers in PendCtr before it retries OSMemGet() and blocks, and the blocks
+*                     are pushed on the free list before PendCtr is read.  A block freed while a task gets
+*                     ready to block thus always signals the semaphore, at worst once too many, which only
+*                     makes a later OSMemPend() retry once more.  While PendCtr is not zero, OSMemPut() does not
+*                     keep the blocks in the magazines, so that each released block can wake up a waiting task.
+*
+*                 (5) The usage statistics are only kept with OS_CFG_DBG_EN, see os.h MEMORY PARTITIONS Note #4.
+*                     The blocks held in magazines are counted in DbgNbrMag, and the lowest number of free blocks
+*                     includes them, so they are not reported as used.
 *********************************************************************************************************
 */
 
 #define   MICRIUM_SOURCE
 #include "os.h"
+#include  <lib_str.h>
 
 
 #if (OS_CFG_MEM_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+static  OS_MEM_MAG  *OS_MemMagGet   (OS_MEM      *p_mem);
+
+static  void         OS_MemMagFill  (OS_MEM      *p_mem,
+                                     OS_MEM_MAG  *p_mag);
+
+static  void         OS_MemMagDrain (OS_MEM      *p_mem,
+                                     OS_MEM_MAG  *p_mag,
+                                     OS_MEM_QTY   nbr,
+                                     OS_ERR      *p_err);
+#endif
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+static  void         OS_MemDbgFail     (OS_MEM      *p_mem);
+
+static  void         OS_MemDbgFreeMin  (OS_MEM      *p_mem,
+                                        CPU_INT32U   nbr_free);
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+static  void         OS_MemDbgMagAdd   (OS_MEM      *p_mem,
+                                        CPU_INT32U   nbr);
+#endif
+
+static  void         OS_MemDbgOwnerSet (OS_MEM      *p_mem,
+                                        void        *p_blk,
+                                        CPU_BOOLEAN  got);
+#endif
+
+#if (OS_CFG_MEM_MSG_EN == DEF_ENABLED)
+static  void         OS_MemMsgRefAdd   (OS_MEM_MSG  *p_msg,
+                                        CPU_INT32U   nbr);
+#endif
+
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+static  void         OS_MemPendCtrAdd (OS_MEM      *p_mem,
+                                       CPU_INT32U   nbr);
+
+static  void         OS_MemPendPost   (OS_MEM      *p_mem,
+                                       OS_MEM_QTY   nbr);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                      CREATE A MEMORY PARTITION
@@ -68,6 +145,8 @@
 *                        OS_ERR_MEM_INVALID_SIZE        user specified an invalid block size
 *                                                         - must be greater than the size of a pointer
 *                                                         - must be able to hold an integral number of pointers
+*                        Other                          OS_ERR_xxx returned by OSSemCreate() when
+*                                                         OS_CFG_MEM_PEND_EN is enabled
 * Returns    : none
 *********************************************************************************************************
 */
@@ -132,6 +211,17 @@ void  OSMemCreate (OS_MEM       *p_mem,
     }
    *p_link             = DEF_NULL;                              /* Last memory block points to NULL                     */
 
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+    OSSemCreate(&p_mem->Sem,                                    /* Semaphore for OSMemPend()                            */
+                 p_name,
+                 0u,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+    p_mem->PendCtr     = 0u;
+#endif
+
     CPU_CRITICAL_ENTER();
 #if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
     p_mem->Type        = OS_OBJ_TYPE_MEM;                       /* Set the type of object                               */
@@ -146,8 +236,17 @@ void  OSMemCreate (OS_MEM       *p_mem,
     p_mem->NbrFree     = n_blks;                                /* Store number of free blocks in MCB                   */
     p_mem->NbrMax      = n_blks;
     p_mem->BlkSize     = blk_size;                              /* Store block size of each memory blocks               */
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    p_mem->MagTbl      = DEF_NULL;                              /* Magazines are added with OSMemMagSet()               */
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_mem->DbgNbrFreeMin = n_blks;
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    p_mem->DbgNbrMag     = 0u;
+#endif
+    p_mem->DbgFailCtr    = 0u;
+    p_mem->DbgOwnerTbl   = DEF_NULL;                            /* Owners are tracked after OSMemOwnerTblSet()          */
     OS_MemDbgListAdd(p_mem);
 #endif
 
@@ -172,17 +271,26 @@ void  OSMemCreate (OS_MEM       *p_mem,
 *                       OS_ERR_NONE               if the memory partition has been created correctly.
 *                       OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
 *                       OS_ERR_MEM_NO_FREE_BLKS   if there are no more free memory blocks to allocate to the caller
+*                       OS_ERR_OBJ_TYPE           if 'p_mem' is not pointing at a memory partition
 *
 * Returns     : A pointer to a memory block if no error is detected
 *               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) This function can be called from an ISR, it does not mask interrupts (see os_mem.c Note #1).
+*
+*               2) A task is served from its magazine when the partition has one (see os_mem.c Note #3).  It can
+*                  get OS_ERR_MEM_NO_FREE_BLKS while other tasks still hold free blocks in their magazines.
 ************************************************************************************************************************
 */
 
 void  *OSMemGet (OS_MEM  *p_mem,
                  OS_ERR  *p_err)
 {
-    void    *p_blk;
-    CPU_SR_ALLOC();
+    void        *p_blk;
+    CPU_INT32U   nbr_free;
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    OS_MEM_MAG  *p_mag;
+#endif
 
 
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
@@ -192,16 +300,55 @@ void  *OSMemGet (OS_MEM  *p_mem,
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-    if (p_mem->NbrFree == 0u) {                                 /* See if there are any free memory blocks              */
-        CPU_CRITICAL_EXIT();
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (DEF_NULL);
+    }
+#endif
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    p_mag = OS_MemMagGet(p_mem);
+    if (p_mag != DEF_NULL) {
+        if (p_mag->NbrBlk == 0u) {                              /* Refill an empty magazine from the free list          */
+            OS_MemMagFill(p_mem, p_mag);
+            if (p_mag->NbrBlk == 0u) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+                OS_MemDbgFail(p_mem);
+#endif
+               *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+                return (DEF_NULL);
+            }
+        }
+        p_mag->NbrBlk--;                                        /* Hand out the most recently freed block               */
+        p_blk = p_mag->BlkTbl[p_mag->NbrBlk];
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+        OS_MemDbgMagAdd(p_mem, (CPU_INT32U)-1);
+        OS_MemDbgFreeMin(p_mem, p_mem->NbrFree);
+        OS_MemDbgOwnerSet(p_mem, p_blk, DEF_YES);
+#endif
+       *p_err = OS_ERR_NONE;
+        return (p_blk);
+    }
+#endif
+
+    p_blk = OS_CPU_ListPop(&p_mem->FreeListPtr);                /* Unlink the first free block                          */
+    if (p_blk == DEF_NULL) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+        OS_MemDbgFail(p_mem);
+#endif
        *p_err = OS_ERR_MEM_NO_FREE_BLKS;                        /* No,  Notify caller of empty memory partition         */
         return (DEF_NULL);                                      /* Return NULL pointer to caller                        */
     }
-    p_blk              = p_mem->FreeListPtr;                    /* Yes, point to next free memory block                 */
-    p_mem->FreeListPtr = *(void **)p_blk;                       /* Adjust pointer to new free list                      */
-    p_mem->NbrFree--;                                           /* One less memory block in this partition              */
-    CPU_CRITICAL_EXIT();
+
+    do {                                                        /* One less memory block in this partition              */
+        nbr_free = p_mem->NbrFree;
+    } while (OS_CPU_CmpSwap(&p_mem->NbrFree, nbr_free, nbr_free - 1u) != DEF_OK);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MemDbgFreeMin(p_mem, nbr_free - 1u);
+    OS_MemDbgOwnerSet(p_mem, p_blk, DEF_YES);
+#endif
    *p_err = OS_ERR_NONE;                                        /* No error                                             */
     return (p_blk);                                             /* Return memory block to caller                        */
 }
@@ -224,6 +371,18 @@ void  *OSMemGet (OS_MEM  *p_mem,
 *                                                      partition (You freed more blocks than you allocated!)
 *                            OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for the block to release.
 *                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OBJ_TYPE           if 'p_mem' is not pointing at a memory partition
+*
+* Note(s)     : 1) This function can be called from an ISR, it does not mask interrupts (see os_mem.c Note #1).
+*
+*               2) A task returns the block to its magazine when the partition has one (see os_mem.c Note #3).
+*                  OS_ERR_MEM_FULL is then only reported when the magazine overflows to the free list.
+*
+*               3) A full magazine that cannot be drained, because blocks were freed twice, is left as is and the
+*                  block goes to the free list.  Only a block the free list cannot take is rejected.
+*
+*               4) While tasks wait in OSMemPend(), the block bypasses the magazine and goes to the free list, so
+*                  that it wakes up one of them.
 ************************************************************************************************************************
 */
 
@@ -231,7 +390,10 @@ void  OSMemPut (OS_MEM  *p_mem,
                 void    *p_blk,
                 OS_ERR  *p_err)
 {
-    CPU_SR_ALLOC();
+    CPU_INT32U   nbr_free;
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    OS_MEM_MAG  *p_mag;
+#endif
 
 
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
@@ -245,68 +407,1880 @@ void  OSMemPut (OS_MEM  *p_mem,
     }
 #endif
 
-    CPU_CRITICAL_ENTER();
-    if (p_mem->NbrFree >= p_mem->NbrMax) {                      /* Make sure all blocks not already returned            */
-        CPU_CRITICAL_EXIT();
-       *p_err = OS_ERR_MEM_FULL;
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
         return;
     }
-    *(void **)p_blk    = p_mem->FreeListPtr;                    /* Insert released block into free block list           */
-    p_mem->FreeListPtr = p_blk;
-    p_mem->NbrFree++;                                           /* One more memory block in this partition              */
-    CPU_CRITICAL_EXIT();
+#endif
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MemDbgOwnerSet(p_mem, p_blk, DEF_NO);
+#endif
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    p_mag = OS_MemMagGet(p_mem);
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+    if (p_mem->PendCtr > 0u) {                                  /* Hand the block to the waiting tasks (see Note #4)    */
+        p_mag = DEF_NULL;
+    }
+#endif
+    if (p_mag != DEF_NULL) {
+        if (p_mag->NbrBlk >= OS_CFG_MEM_MAG_SIZE) {             /* Drain the oldest half of a full magazine             */
+            OS_MemMagDrain(p_mem, p_mag, OS_MEM_MAG_BATCH, p_err);
+        }
+        if (p_mag->NbrBlk < OS_CFG_MEM_MAG_SIZE) {
+            p_mag->BlkTbl[p_mag->NbrBlk] = p_blk;
+            p_mag->NbrBlk++;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+            OS_MemDbgMagAdd(p_mem, 1u);
+#endif
+           *p_err = OS_ERR_NONE;
+            return;
+        }
+    }                                                           /* Drain failed, use the free list (see Note #3)        */
+#endif
+
+    do {                                                        /* One more memory block in this partition              */
+        nbr_free = p_mem->NbrFree;
+        if (nbr_free >= p_mem->NbrMax) {                        /* Make sure all blocks not already returned            */
+           *p_err = OS_ERR_MEM_FULL;
+            return;
+        }
+    } while (OS_CPU_CmpSwap(&p_mem->NbrFree, nbr_free, nbr_free + 1u) != DEF_OK);
+
+    OS_CPU_ListPush(&p_mem->FreeListPtr, p_blk);                /* Insert released block into free block list           */
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+    OS_MemPendPost(p_mem, 1u);                                  /* Wake up a task waiting for a block                   */
+#endif
    *p_err              = OS_ERR_NONE;                           /* Notify caller that memory block was released         */
 }
 
 
 /*
 ************************************************************************************************************************
-*                                           ADD MEMORY PARTITION TO DEBUG LIST
+*                                             WAIT FOR A MEMORY BLOCK
 *
-* Description : This function is called by OSMemCreate() to add the memory partition to the debug table.
+* Description : Get a memory block from a partition, waiting for one to be released if the partition is empty.
 *
-* Arguments   : p_mem    Is a pointer to the memory partition
+* Arguments   : p_mem     is a pointer to the memory partition control block
+*
+*               timeout   is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a block
+*                         up to the amount of time specified by this argument.  If you specify 0, your task will wait
+*                         forever.
+*
+*               opt       determines whether the user wants to block if the partition is empty or not:
+*
+*                             OS_OPT_PEND_BLOCKING
+*                             OS_OPT_PEND_NON_BLOCKING
+*
+*               p_err     is a pointer to a variable containing an error message which will be set by this function to
+*                         either:
+*
+*                             OS_ERR_NONE               if a block was obtained
+*                             OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                             OS_ERR_OBJ_TYPE           if 'p_mem' is not pointing at a memory partition
+*                             OS_ERR_OPT_INVALID        if you specified an invalid value for 'opt'
+*                             OS_ERR_PEND_ABORT         if the wait was aborted with OSSemPendAbort()
+*                             OS_ERR_PEND_ISR           if you called this function from an ISR
+*                             OS_ERR_PEND_WOULD_BLOCK   if you specified non-blocking but the partition was empty
+*                             OS_ERR_SCHED_LOCKED       if the partition was empty and the scheduler is locked
+*                             OS_ERR_TIMEOUT            if no block was released within the specified timeout
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) A released block wakes up one waiting task, which retries OSMemGet().  If another task took the
+*                  block first, the waiting task blocks again for the rest of the timeout (see os_mem.c Note #4).
+*
+*               2) While a task waits, the blocks released by the other tasks bypass their magazines and go to the
+*                  free list (see os_mem.c Note #4).  Blocks that were already kept in magazines before the task
+*                  started to wait stay there until their owners use, flush or drain them.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+void  *OSMemPend (OS_MEM   *p_mem,
+                  OS_TICK   timeout,
+                  OS_OPT    opt,
+                  OS_ERR   *p_err)
+{
+    void     *p_blk;
+    OS_TICK   tick_start;
+    OS_TICK   tick_elapsed;
+    OS_TICK   tick_left;
+    OS_ERR    err;
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return (DEF_NULL);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return (DEF_NULL);
+    }
+
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (DEF_NULL);
+    }
+#endif
+
+    p_blk = OSMemGet(p_mem, p_err);                             /* Fast path, also validates the partition type         */
+    if (*p_err != OS_ERR_MEM_NO_FREE_BLKS) {
+        return (p_blk);
+    }
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (DEF_NULL);
+    }
+
+    tick_start = OSTimeGet(&err);
+    tick_left  = timeout;
+    OS_MemPendCtrAdd(p_mem, 1u);                                /* Register before the last retry (see Note #4)         */
+    for (;;) {
+        p_blk = OSMemGet(p_mem, p_err);
+        if (*p_err != OS_ERR_MEM_NO_FREE_BLKS) {
+            break;
+        }
+        if (timeout != 0u) {                                    /* Wait for the rest of the timeout only                */
+            tick_elapsed = OSTimeGet(&err) - tick_start;
+            if (tick_elapsed >= timeout) {
+               *p_err = OS_ERR_TIMEOUT;
+                break;
+            }
+            tick_left = timeout - tick_elapsed;
+        }
+        (void)OSSemPend(&p_mem->Sem,
+                         tick_left,
+                         OS_OPT_PEND_BLOCKING,
+                         DEF_NULL,
+                         p_err);
+        if (*p_err != OS_ERR_NONE) {                            /* Timeout, abort or scheduler locked                   */
+            break;
+        }
+    }
+    OS_MemPendCtrAdd(p_mem, (CPU_INT32U)-1);
+
+    return (p_blk);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          OUTPUT THE MEMORY PARTITION USAGE
+*
+* Description : Outputs a usage report of all the memory partitions through 'out_fnct'.  For each partition, it gives the
+*               block size, the number of blocks, the number of free blocks, the number of free blocks held in the
+*               magazines, the highest number of blocks used at once and the number of gets that found the partition
+*               empty.  A partition with an owner table also reports the
+*               number of blocks held by each task.
+*
+* Arguments   : out_fnct  is a pointer to the output function.
+*
+*               p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE               if the report was output
+*                             OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'out_fnct'
 *
 * Returns     : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)     : 1) The statistics are read without masking interrupts, a partition in use may be reported slightly
+*                  inconsistently.  Partitions cannot be deleted, so the debug list can be walked safely.
 ************************************************************************************************************************
 */
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
-void  OS_MemDbgListAdd (OS_MEM  *p_mem)
+void  OSMemOutputUsage (void    (*out_fnct)(CPU_CHAR *),
+                        OS_ERR   *p_err)
 {
-    p_mem->DbgPrevPtr               = DEF_NULL;
-    if (OSMemDbgListPtr == DEF_NULL) {
-        p_mem->DbgNextPtr           = DEF_NULL;
-    } else {
-        p_mem->DbgNextPtr           =  OSMemDbgListPtr;
-        OSMemDbgListPtr->DbgPrevPtr =  p_mem;
+    CPU_CHAR     str[DEF_INT_32U_NBR_DIG_MAX + 1u];
+    OS_MEM_QTY   owner_tbl[OS_HWOS_CNTX_CNT + 1u];              /* Blocks per context, the last entry for the ISRs      */
+    OS_MEM      *p_mem;
+    OS_TCB      *p_tcb;
+    OS_MEM_QTY   i;
+    CPU_INT32U   ctx_id;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (out_fnct == DEF_NULL) {                                 /* Must pass a valid output function                    */
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
     }
-    OSMemDbgListPtr                 =  p_mem;
+#endif
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    out_fnct("------------------------------------- Memory partition usage --------------------------------------\r\n");
+    out_fnct("| Blk size   | Blks       | Free       | In mags    | Used max   | Fails      | Name\r\n");
+    out_fnct("|------------|------------|------------|------------|------------|------------|-------------------\r\n");
+#else
+    out_fnct("------------------------------- Memory partition usage -------------------------------\r\n");
+    out_fnct("| Blk size   | Blks       | Free       | Used max   | Fails      | Name\r\n");
+    out_fnct("|------------|------------|------------|------------|------------|-------------------\r\n");
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_mem = OSMemDbgListPtr;
+    CPU_CRITICAL_EXIT();
+
+    while (p_mem != DEF_NULL) {
+        out_fnct("| ");
+        (void)Str_FmtNbr_Int32U(p_mem->BlkSize,               10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct(" | ");
+        (void)Str_FmtNbr_Int32U(p_mem->NbrMax,                10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct(" | ");
+        (void)Str_FmtNbr_Int32U(p_mem->NbrFree,               10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct(" | ");
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+        (void)Str_FmtNbr_Int32U(p_mem->DbgNbrMag,             10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct(" | ");
+#endif
+        (void)Str_FmtNbr_Int32U(p_mem->NbrMax - p_mem->DbgNbrFreeMin,
+                                                              10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct(" | ");
+        (void)Str_FmtNbr_Int32U(p_mem->DbgFailCtr,            10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct(" | ");
+        out_fnct((p_mem->NamePtr != DEF_NULL) ? p_mem->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct("\r\n");
+
+        if (p_mem->DbgOwnerTbl != DEF_NULL) {                   /* Count the blocks held by each context                */
+            for (ctx_id = 0u; ctx_id <= OS_HWOS_CNTX_CNT; ctx_id++) {
+                owner_tbl[ctx_id] = 0u;
+            }
+            for (i = 0u; i < p_mem->NbrMax; i++) {
+                ctx_id = p_mem->DbgOwnerTbl[i];
+                if (ctx_id < OS_HWOS_CNTX_CNT) {
+                    owner_tbl[ctx_id]++;
+                } else if (ctx_id == OS_MEM_OWNER_ISR) {
+                    owner_tbl[OS_HWOS_CNTX_CNT]++;
+                }
+            }
+
+            for (ctx_id = 0u; ctx_id <= OS_HWOS_CNTX_CNT; ctx_id++) {
+                if (owner_tbl[ctx_id] == 0u) {
+                    continue;
+                }
+                out_fnct("| -> Owner   | ");
+                (void)Str_FmtNbr_Int32U(owner_tbl[ctx_id],    10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+                out_fnct(str);
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+                out_fnct(" |            |            |            |            | ");
+#else
+                out_fnct(" |            |            |            | ");
+#endif
+                if (ctx_id == OS_HWOS_CNTX_CNT) {
+                    out_fnct((CPU_CHAR *)"ISR");
+                } else {
+                    p_tcb = OSTaskTCBPtrTbl[ctx_id];
+                    out_fnct(((p_tcb != DEF_NULL) && (p_tcb->NamePtr != DEF_NULL)) ? p_tcb->NamePtr
+                                                                                  : (CPU_CHAR *)"Unknown");
+                }
+                out_fnct("\r\n");
+            }
+        }
+
+        p_mem = p_mem->DbgNextPtr;
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                      ADD AN OWNER TABLE TO A MEMORY PARTITION
+*
+* Description : Makes a partition record the context that got each of its blocks (see os.h MEMORY PARTITIONS Note #4).
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_tbl    is a pointer to a table of one CPU_INT08U per block of the partition, allocated by the
+*                        application.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                if the owner table was added to the partition
+*                            OS_ERR_MEM_INVALID_P_DATA  if you passed a NULL pointer for 'p_tbl'
+*                            OS_ERR_MEM_INVALID_P_MEM   if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OBJ_TYPE            if 'p_mem' is not pointing at a memory partition
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function should be called right after OSMemCreate(), the blocks got before are not tracked.
+************************************************************************************************************************
+*/
+
+void  OSMemOwnerTblSet (OS_MEM      *p_mem,
+                        CPU_INT08U  *p_tbl,
+                        OS_ERR      *p_err)
+{
+    OS_MEM_QTY  i;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_tbl == DEF_NULL) {                                    /* Must pass a valid owner table                        */
+       *p_err  = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    for (i = 0u; i < p_mem->NbrMax; i++) {
+        p_tbl[i] = OS_MEM_OWNER_NONE;
+    }
+    p_mem->DbgOwnerTbl = p_tbl;
+   *p_err              = OS_ERR_NONE;
 }
 #endif
 
 
 /*
 ************************************************************************************************************************
-*                                           INITIALIZE MEMORY PARTITION MANAGER
+*                                          ADD A SIZE CLASS TO THE SLAB ALLOCATOR
 *
-* Description : This function is called by uC/OS-III to initialize the memory partition manager.  Your
-*               application MUST NOT call this function.
+* Description : Adds a memory partition to the size classes served by OSMemSlabAlloc() and OSMemSlabFree().
 *
-* Arguments   : none
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the partition was added
+*                            OS_ERR_MEM_CREATE_ISR     if you called this function from an ISR
+*                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_MEM_INVALID_PART   if the partition was already added, or if there are already
+*                                                      OS_CFG_MEM_SLAB_CLASS_NBR size classes
+*                            OS_ERR_OBJ_TYPE           if 'p_mem' is not pointing at a memory partition
 *
 * Returns     : none
 *
-* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+* Note(s)     : 1) The size classes should be added at startup, before the slab allocator is used.  The classes are kept
+*                  sorted by block size, and OSMemSlabClassTbl[] is rebuilt to give, for each 'n', the first class able
+*                  to hold a size in ]2^(n-1), 2^n].
 ************************************************************************************************************************
 */
 
-void  OS_MemInit (OS_ERR  *p_err)
+#if (OS_CFG_MEM_SLAB_EN == DEF_ENABLED)
+void  OSMemSlabAdd (OS_MEM  *p_mem,
+                    OS_ERR  *p_err)
 {
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-    OSMemDbgListPtr = DEF_NULL;
+    CPU_INT08U  class_ix;
+    CPU_INT08U  bucket;
+    CPU_SIZE_T  size_min;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_MEM_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OSMemSlabClassNbr >= OS_CFG_MEM_SLAB_CLASS_NBR) {       /* No room for another size class                       */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_INVALID_PART;
+        return;
+    }
+    for (class_ix = 0u; class_ix < OSMemSlabClassNbr; class_ix++) {
+        if (OSMemSlabTbl[class_ix] == p_mem) {                  /* Partition already added                              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_MEM_INVALID_PART;
+            return;
+        }
+    }
+
+    class_ix = OSMemSlabClassNbr;                               /* Insert the partition by block size                   */
+    while ((class_ix > 0u) && (OSMemSlabTbl[class_ix - 1u]->BlkSize > p_mem->BlkSize)) {
+        OSMemSlabTbl[class_ix] = OSMemSlabTbl[class_ix - 1u];
+        class_ix--;
+    }
+    OSMemSlabTbl[class_ix] = p_mem;
+    OSMemSlabClassNbr++;
+
+    for (bucket = 0u; bucket <= DEF_INT_CPU_NBR_BITS; bucket++) {
+        if (bucket == 0u) {                                     /* Smallest size that maps to this power of 2           */
+            size_min = 1u;
+        } else {
+            size_min = ((CPU_SIZE_T)1u << (bucket - 1u)) + 1u;
+        }
+        class_ix = 0u;
+        while ((class_ix < OSMemSlabClassNbr) && (OSMemSlabTbl[class_ix]->BlkSize < size_min)) {
+            class_ix++;
+        }
+        OSMemSlabClassTbl[bucket] = class_ix;
+    }
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ALLOCATE A BLOCK FROM THE SLAB ALLOCATOR
+*
+* Description : Gets a block of at least 'size' bytes from the smallest size class that can hold it, or from the next
+*               larger classes if that one is empty.
+*
+* Arguments   : size     is the number of bytes needed
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if a block was allocated
+*                            OS_ERR_MEM_INVALID_SIZE   if 'size' is 0 or larger than the largest size class
+*                            OS_ERR_MEM_NO_FREE_BLKS   if all the size classes able to hold 'size' are empty
+*
+* Returns     : A pointer to a memory block if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The first class to try is found with CPU_CntLeadZeros() and OSMemSlabClassTbl[] (see OSMemSlabAdd()
+*                  Note #1), then skips at most the classes whose block size is in the same power of 2 as 'size'.
+*
+*               2) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  *OSMemSlabAlloc (CPU_SIZE_T   size,
+                       OS_ERR      *p_err)
+{
+    void        *p_blk;
+    CPU_INT08U   class_ix;
+    CPU_INT08U   bucket;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (size == 0u) {                                           /* Must ask for at least one byte                       */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return (DEF_NULL);
+    }
+#endif
+
+    bucket   = (CPU_INT08U)(DEF_INT_CPU_NBR_BITS - CPU_CntLeadZeros((CPU_DATA)(size - 1u)));
+    class_ix = OSMemSlabClassTbl[bucket];                       /* First class for sizes up to 2^bucket                 */
+    while ((class_ix < OSMemSlabClassNbr) && (OSMemSlabTbl[class_ix]->BlkSize < size)) {
+        class_ix++;
+    }
+    if (class_ix >= OSMemSlabClassNbr) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return (DEF_NULL);
+    }
+
+    do {
+        p_blk = OSMemGet(OSMemSlabTbl[class_ix], p_err);
+        if (*p_err != OS_ERR_MEM_NO_FREE_BLKS) {
+            return (p_blk);
+        }
+        class_ix++;                                             /* Fall back to the next larger class                   */
+    } while (class_ix < OSMemSlabClassNbr);
+
+    return (DEF_NULL);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RELEASE A BLOCK TO THE SLAB ALLOCATOR
+*
+* Description : Returns a block got with OSMemSlabAlloc() to the size class it belongs to.
+*
+* Arguments   : p_blk    is a pointer to the memory block being released.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the block was released
+*                            OS_ERR_MEM_INVALID_P_BLK  if 'p_blk' is not a block of one of the size classes
+*                            Other                     OS_ERR_xxx returned by OSMemPut()
+*
+* Returns     : none
+*
+* Note(s)     : 1) The size class is found from the address of the block, by checking the address range of each class.
+*
+*               2) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemSlabFree (void    *p_blk,
+                     OS_ERR  *p_err)
+{
+    OS_MEM      *p_mem;
+    CPU_ADDR     offset;
+    CPU_INT08U   class_ix;
+
+
+    for (class_ix = 0u; class_ix < OSMemSlabClassNbr; class_ix++) {
+        p_mem  = OSMemSlabTbl[class_ix];
+        offset = (CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr;
+        if (offset < ((CPU_ADDR)p_mem->NbrMax * p_mem->BlkSize)) {
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+            if ((offset % p_mem->BlkSize) != 0u) {              /* Must point to the start of a block                   */
+               *p_err = OS_ERR_MEM_INVALID_P_BLK;
+                return;
+            }
+#endif
+            OSMemPut(p_mem, p_blk, p_err);
+            return;
+        }
+    }
+
+   *p_err = OS_ERR_MEM_INVALID_P_BLK;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            GET A ZERO-COPY MESSAGE BLOCK
+*
+* Description : Gets a block from a partition and initializes its message header (see os.h MEMORY PARTITIONS Note #6).
+*               The caller is the only owner of the message.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if a message block was obtained
+*                            OS_ERR_MEM_INVALID_SIZE   if the blocks of the partition cannot hold a header and payload
+*                            Other                     OS_ERR_xxx returned by OSMemGet()
+*
+* Returns     : A pointer to the payload, which can hold (BlkSize - OS_MEM_MSG_HDR_SIZE) bytes, if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_MSG_EN == DEF_ENABLED)
+void  *OSMemMsgGet (OS_MEM  *p_mem,
+                    OS_ERR  *p_err)
+{
+    OS_MEM_MSG  *p_msg;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return (DEF_NULL);
+    }
+    if (p_mem->BlkSize <= OS_MEM_MSG_HDR_SIZE) {                /* Must have room for a header and some payload         */
+       *p_err  = OS_ERR_MEM_INVALID_SIZE;
+        return (DEF_NULL);
+    }
+#endif
+
+    p_msg = (OS_MEM_MSG *)OSMemGet(p_mem, p_err);
+    if (p_msg == DEF_NULL) {
+        return (DEF_NULL);
+    }
+
+    p_msg->MemPtr = p_mem;
+    p_msg->RefCtr = 1u;
+    p_msg->Len    = 0u;
+
+    return ((void *)((CPU_INT08U *)p_msg + OS_MEM_MSG_HDR_SIZE));
+}
+
+
+/*
+************************************************************************************************************************
+*                                          WAIT FOR A ZERO-COPY MESSAGE
+*
+* Description : Waits for a message posted with OSMemMsgPost() or OSMemMsgPostMulti().  The caller becomes one of the
+*               owners of the message and must release it with OSMemMsgRelease(), or pass it on with OSMemMsgPost().
+*
+* Arguments   : p_q        is a pointer to the message queue
+*
+*               timeout    is an optional timeout period (in clock ticks), see OSQPend()
+*
+*               opt        OS_OPT_PEND_BLOCKING or OS_OPT_PEND_NON_BLOCKING, see OSQPend()
+*
+*               p_len      is a pointer to a variable that will receive the length of the payload.  You can pass a NULL
+*                          pointer if you don't need it.
+*
+*               p_ts       is a pointer to a variable that will receive the timestamp, see OSQPend()
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               if a message was received
+*                              Other                     OS_ERR_xxx returned by OSQPend()
+*
+* Returns     : A pointer to the payload if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The HWOS mailboxes only carry the message pointer, the length is read back from the message header.
+************************************************************************************************************************
+*/
+
+void  *OSMemMsgPend (OS_Q          *p_q,
+                     OS_TICK        timeout,
+                     OS_OPT         opt,
+                     OS_MSG_SIZE   *p_len,
+                     CPU_TS        *p_ts,
+                     OS_ERR        *p_err)
+{
+    void  *p_data;
+
+
+    p_data = OSQPend(p_q,
+                     timeout,
+                     opt,
+                     DEF_NULL,
+                     p_ts,
+                     p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (DEF_NULL);
+    }
+
+    if (p_len != DEF_NULL) {
+       *p_len = OS_MEM_MSG_HDR(p_data)->Len;
+    }
+
+    return (p_data);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          POST A ZERO-COPY MESSAGE
+*
+* Description : Records the length of the payload in the message header and posts the message to a queue.  The
+*               ownership of the caller moves to the task that receives the message.
+*
+* Arguments   : p_q        is a pointer to the message queue
+*
+*               p_data     is a pointer to the payload, as returned by OSMemMsgGet() or OSMemMsgPend()
+*
+*               len        is the length (in bytes) of the payload
+*
+*               opt        determines the type of POST performed, see OSQPost().  OS_OPT_POST_ALL is not allowed since
+*                          the number of receivers, and thus of owners, would be unknown.
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               if the message was posted
+*                              OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for 'p_data'
+*                              OS_ERR_OPT_INVALID        if you specified OS_OPT_POST_ALL
+*                              Other                     OS_ERR_xxx returned by OSQPost()
+*
+* Returns     : none
+*
+* Note(s)     : 1) The caller remains the owner of the message if the post fails.
+*
+*               2) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemMsgPost (OS_Q          *p_q,
+                    void          *p_data,
+                    OS_MSG_SIZE    len,
+                    OS_OPT         opt,
+                    OS_ERR        *p_err)
+{
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_data == DEF_NULL) {                                   /* Must post a valid message                            */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+    if ((opt & OS_OPT_POST_ALL) != 0u) {                        /* The receivers must be known                          */
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+
+    OS_MEM_MSG_HDR(p_data)->Len = len;                          /* Set before the receiver can run                      */
+
+    OSQPost(p_q,
+            p_data,
+            len,
+            opt,
+            p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    POST A ZERO-COPY MESSAGE TO SEVERAL QUEUES
+*
+* Description : Posts the same message to each queue of 'p_q_tbl'.  Each task that receives the message becomes one of
+*               its owners, and the block returns to its partition once all of them have released it.
+*
+* Arguments   : p_q_tbl    is a pointer to a table of 'q_nbr' message queues
+*
+*               q_nbr      is the number of message queues in 'p_q_tbl'
+*
+*               p_data     is a pointer to the payload, as returned by OSMemMsgGet() or OSMemMsgPend()
+*
+*               len        is the length (in bytes) of the payload
+*
+*               opt        determines the type of POST performed, see OSMemMsgPost()
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               if the message was posted to every queue
+*                              OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for 'p_data'
+*                              OS_ERR_OPT_INVALID        if you specified OS_OPT_POST_ALL
+*                              OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_q_tbl'
+*                              Other                     OS_ERR_xxx returned by OSQPost() for the first failed post
+*
+* Returns     : The number of queues the message was posted to.
+*
+* Note(s)     : 1) Unlike OSMemMsgPost(), the ownership of the caller always ends, even if some posts failed.  The block
+*                  is released right away if no post succeeded.
+*
+*               2) The owners are counted before posting, since the first receiver may release the message before
+*                  the message is posted to the next queue.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSMemMsgPostMulti (OS_Q         **p_q_tbl,
+                               OS_OBJ_QTY     q_nbr,
+                               void          *p_data,
+                               OS_MSG_SIZE    len,
+                               OS_OPT         opt,
+                               OS_ERR        *p_err)
+{
+    OS_MEM_MSG  *p_msg;
+    OS_OBJ_QTY   i;
+    OS_OBJ_QTY   nbr_posted;
+    OS_ERR       err;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q_tbl == DEF_NULL) {                                  /* Must pass a valid table of queues                    */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (p_data == DEF_NULL) {                                   /* Must post a valid message                            */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return (0u);
+    }
+    if ((opt & OS_OPT_POST_ALL) != 0u) {                        /* The receivers must be known                          */
+       *p_err = OS_ERR_OPT_INVALID;
+        return (0u);
+    }
+#endif
+
+    p_msg      = OS_MEM_MSG_HDR(p_data);
+    p_msg->Len = len;
+    OS_MemMsgRefAdd(p_msg, q_nbr);                              /* One owner per queue (see Note #2)                    */
+
+   *p_err      = OS_ERR_NONE;
+    nbr_posted = 0u;
+    for (i = 0u; i < q_nbr; i++) {
+        OSQPost(p_q_tbl[i],
+                p_data,
+                len,
+                opt,
+               &err);
+        if (err == OS_ERR_NONE) {
+            nbr_posted++;
+        } else {
+            OS_MemMsgRefAdd(p_msg, (CPU_INT32U)-1);             /* Nobody received this copy                            */
+            if (*p_err == OS_ERR_NONE) {
+               *p_err = err;
+            }
+        }
+    }
+
+    OSMemMsgRelease(p_data, &err);                              /* Drop the reference of the caller (see Note #1)       */
+
+    return (nbr_posted);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          RELEASE A ZERO-COPY MESSAGE
+*
+* Description : Drops one owner of a message.  The last owner returns the block to the partition it was got from.
+*
+* Arguments   : p_data     is a pointer to the payload, as returned by OSMemMsgGet() or OSMemMsgPend()
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE               if the message was released
+*                              OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for 'p_data', or if the message
+*                                                        has no owner left
+*                              Other                     OS_ERR_xxx returned by OSMemPut()
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemMsgRelease (void    *p_data,
+                       OS_ERR  *p_err)
+{
+    OS_MEM_MSG  *p_msg;
+    CPU_INT32U   ref_ctr;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_data == DEF_NULL) {                                   /* Must release a valid message                         */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    p_msg = OS_MEM_MSG_HDR(p_data);
+    do {
+        ref_ctr = p_msg->RefCtr;
+        if (ref_ctr == 0u) {                                    /* Message already released                             */
+           *p_err = OS_ERR_MEM_INVALID_P_BLK;
+            return;
+        }
+    } while (OS_CPU_CmpSwap(&p_msg->RefCtr, ref_ctr, ref_ctr - 1u) != DEF_OK);
+
+    if (ref_ctr == 1u) {                                        /* Last owner, return the block                         */
+        OSMemPut(p_msg->MemPtr, (void *)p_msg, p_err);
+        return;
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            CONCATENATE TWO BUFFER CHAINS
+*
+* Description : Links 'p_tail' after the last piece of 'p_head'.  Prepending a header is done with
+*               OSMemBufCat(p_hdr, p_chain) and appending a trailer with OSMemBufCat(p_chain, p_trailer).
+*
+* Arguments   : p_head   is a pointer to the first chain, or DEF_NULL for an empty chain.
+*
+*               p_tail   is a pointer to the chain to link after 'p_head'.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the chains were linked
+*                            OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_tail'
+*
+* Returns     : A pointer to the resulting chain.
+*
+* Note(s)     : 1) No payload byte is copied.  'p_tail' must not be used on its own afterwards.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_BUF_EN == DEF_ENABLED)
+OS_MEM_BUF  *OSMemBufCat (OS_MEM_BUF  *p_head,
+                          OS_MEM_BUF  *p_tail,
+                          OS_ERR      *p_err)
+{
+    OS_MEM_BUF  *p_buf;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_tail == DEF_NULL) {                                   /* Must link a valid chain                              */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (p_head);
+    }
+#endif
+
+   *p_err = OS_ERR_NONE;
+    if (p_head == DEF_NULL) {
+        return (p_tail);
+    }
+
+    p_buf = p_head;                                             /* Find the last piece of the first chain               */
+    while (p_buf->NextPtr != DEF_NULL) {
+        p_buf = p_buf->NextPtr;
+    }
+    p_buf->NextPtr = p_tail;
+
+    return (p_head);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                CLONE A BUFFER CHAIN
+*
+* Description : Builds a new chain referring to the same payload bytes as 'p_chain'.
+*
+* Arguments   : p_chain  is a pointer to the chain to clone.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the chain was cloned
+*                            OS_ERR_MEM_INVALID_P_MEM  if OSMemBufDescSet() was not called
+*                            OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_chain'
+*                            Other                     OS_ERR_xxx returned by OSMemGet() for the descriptors
+*
+* Returns     : A pointer to the new chain if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) Only the descriptors are duplicated, each one taking a reference to its message.  The payload bytes
+*                  are shared and must thus not be modified while both chains are in use.
+************************************************************************************************************************
+*/
+
+OS_MEM_BUF  *OSMemBufClone (OS_MEM_BUF  *p_chain,
+                            OS_ERR      *p_err)
+{
+    OS_MEM_BUF   *p_clone;
+    OS_MEM_BUF  **pp_link;
+    OS_MEM_BUF   *p_buf;
+    OS_ERR        err;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_chain == DEF_NULL) {                                  /* Must clone a valid chain                             */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (OSMemBufDescPtr == DEF_NULL) {                          /* Descriptors are set with OSMemBufDescSet()           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return (DEF_NULL);
+    }
+
+    p_clone = DEF_NULL;
+    pp_link = &p_clone;
+    while (p_chain != DEF_NULL) {
+        p_buf = (OS_MEM_BUF *)OSMemGet(OSMemBufDescPtr, p_err);
+        if (p_buf == DEF_NULL) {
+            if (p_clone != DEF_NULL) {                          /* Undo the pieces already cloned                       */
+                OSMemBufFree(p_clone, &err);
+            }
+            return (DEF_NULL);
+        }
+        p_buf->NextPtr = DEF_NULL;
+        p_buf->DataPtr = p_chain->DataPtr;
+        p_buf->Offset  = p_chain->Offset;
+        p_buf->Len     = p_chain->Len;
+        OS_MemMsgRefAdd(OS_MEM_MSG_HDR(p_buf->DataPtr), 1u);
+
+       *pp_link = p_buf;
+        pp_link = &p_buf->NextPtr;
+        p_chain = p_chain->NextPtr;
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (p_clone);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    SET THE PARTITION OF THE BUFFER CHAIN DESCRIPTORS
+*
+* Description : Sets the memory partition the OS_MEM_BUF descriptors are got from.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the partition was set
+*                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_MEM_INVALID_SIZE   if the blocks of the partition cannot hold an OS_MEM_BUF
+*                            OS_ERR_OBJ_TYPE           if 'p_mem' is not pointing at a memory partition
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function must be called at startup, before any buffer chain is built.
+************************************************************************************************************************
+*/
+
+void  OSMemBufDescSet (OS_MEM  *p_mem,
+                       OS_ERR  *p_err)
+{
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_mem->BlkSize < sizeof(OS_MEM_BUF)) {                  /* Must hold a descriptor                               */
+       *p_err  = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OSMemBufDescPtr = p_mem;
+   *p_err           = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                FREE A BUFFER CHAIN
+*
+* Description : Returns the descriptors of a chain to their partition and releases the messages they refer to.
+*
+* Arguments   : p_chain  is a pointer to the chain to free.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the chain was freed
+*                            Other                     the first OS_ERR_xxx returned by OSMemMsgRelease() or OSMemPut()
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function can be called from an ISR.
+************************************************************************************************************************
+*/
+
+void  OSMemBufFree (OS_MEM_BUF  *p_chain,
+                    OS_ERR      *p_err)
+{
+    OS_MEM_BUF  *p_next;
+    OS_ERR       err;
+
+
+   *p_err = OS_ERR_NONE;
+    while (p_chain != DEF_NULL) {
+        p_next = p_chain->NextPtr;
+
+        OSMemMsgRelease(p_chain->DataPtr, &err);
+        if ((err != OS_ERR_NONE) && (*p_err == OS_ERR_NONE)) {
+           *p_err = err;
+        }
+        OSMemPut(OSMemBufDescPtr, (void *)p_chain, &err);
+        if ((err != OS_ERR_NONE) && (*p_err == OS_ERR_NONE)) {
+           *p_err = err;
+        }
+
+        p_chain = p_next;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                           BUILD A ONE PIECE BUFFER CHAIN
+*
+* Description : Builds a chain of one piece holding 'len' bytes at 'offset' in the payload of a zero-copy message.
+*
+* Arguments   : p_data   is a pointer to the payload, as returned by OSMemMsgGet() or OSMemMsgPend()
+*
+*               offset   is the offset (in bytes) of the first byte of the piece in the payload
+*
+*               len      is the number of bytes of the piece
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the chain was built
+*                            OS_ERR_MEM_INVALID_P_BLK  if you passed a NULL pointer for 'p_data'
+*                            OS_ERR_MEM_INVALID_P_MEM  if OSMemBufDescSet() was not called
+*                            OS_ERR_MEM_INVALID_SIZE   if the piece does not fit in the payload
+*                            Other                     OS_ERR_xxx returned by OSMemGet() for the descriptor
+*
+* Returns     : A pointer to the chain if no error is detected
+*               A pointer to NULL if an error is detected
+*
+* Note(s)     : 1) The chain takes over the caller's reference to the message.  On error, the caller keeps it.
+************************************************************************************************************************
+*/
+
+OS_MEM_BUF  *OSMemBufGet (void         *p_data,
+                          OS_MSG_SIZE   offset,
+                          OS_MSG_SIZE   len,
+                          OS_ERR       *p_err)
+{
+    OS_MEM_BUF  *p_buf;
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    OS_MEM      *p_mem;
+#endif
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_data == DEF_NULL) {                                   /* Must refer to a valid message                        */
+       *p_err = OS_ERR_MEM_INVALID_P_BLK;
+        return (DEF_NULL);
+    }
+    p_mem = OS_MEM_MSG_HDR(p_data)->MemPtr;
+    if (((CPU_INT32U)offset + len) > (p_mem->BlkSize - OS_MEM_MSG_HDR_SIZE)) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;                        /* Piece must fit in the payload                        */
+        return (DEF_NULL);
+    }
+#endif
+
+    if (OSMemBufDescPtr == DEF_NULL) {                          /* Descriptors are set with OSMemBufDescSet()           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return (DEF_NULL);
+    }
+
+    p_buf = (OS_MEM_BUF *)OSMemGet(OSMemBufDescPtr, p_err);
+    if (p_buf == DEF_NULL) {
+        return (DEF_NULL);
+    }
+    p_buf->NextPtr = DEF_NULL;
+    p_buf->DataPtr = p_data;
+    p_buf->Offset  = offset;
+    p_buf->Len     = len;
+
+    return (p_buf);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          GET THE LENGTH OF A BUFFER CHAIN
+*
+* Description : Returns the number of bytes of a chain.
+*
+* Arguments   : p_chain  is a pointer to the chain.
+*
+* Returns     : The sum of the lengths of all the pieces.
+************************************************************************************************************************
+*/
+
+CPU_INT32U  OSMemBufLenGet (OS_MEM_BUF  *p_chain)
+{
+    CPU_INT32U  len;
+
+
+    len = 0u;
+    while (p_chain != DEF_NULL) {
+        len    += p_chain->Len;
+        p_chain = p_chain->NextPtr;
+    }
+
+    return (len);
+}
+
+
+/*
+************************************************************************************************************************
+*                                     FILL A SCATTER-GATHER TABLE FROM A BUFFER CHAIN
+*
+* Description : Fills a table of address/length pairs with the pieces of a chain, e.g. to build the descriptors of a
+*               gather DMA transfer.  Empty pieces are skipped.
+*
+* Arguments   : p_chain   is a pointer to the chain.
+*
+*               p_sg_tbl  is a pointer to a table of 'sg_nbr' entries.
+*
+*               sg_nbr    is the number of entries of 'p_sg_tbl'.
+*
+*               p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE               if the table holds the whole chain
+*                             OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_sg_tbl'
+*                             OS_ERR_MEM_INVALID_SIZE   if the chain has more than 'sg_nbr' non-empty pieces
+*
+* Returns     : The number of entries filled.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSMemBufSGGet (OS_MEM_BUF     *p_chain,
+                           OS_MEM_BUF_SG  *p_sg_tbl,
+                           OS_OBJ_QTY      sg_nbr,
+                           OS_ERR         *p_err)
+{
+    OS_OBJ_QTY  nbr;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_sg_tbl == DEF_NULL) {                                 /* Must pass a valid table                              */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+#endif
+
+    nbr = 0u;
+    while (p_chain != DEF_NULL) {
+        if (p_chain->Len > 0u) {
+            if (nbr >= sg_nbr) {                                /* Table too small for the chain                        */
+               *p_err = OS_ERR_MEM_INVALID_SIZE;
+                return (nbr);
+            }
+            p_sg_tbl[nbr].AddrPtr = OS_MEM_BUF_DATA(p_chain);
+            p_sg_tbl[nbr].Len     = p_chain->Len;
+            nbr++;
+        }
+        p_chain = p_chain->NextPtr;
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (nbr);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                SPLIT A BUFFER CHAIN
+*
+* Description : Cuts a chain in two at byte 'offset'.  'p_chain' keeps the first 'offset' bytes and the remaining bytes
+*               are returned as a new chain.
+*
+* Arguments   : p_chain  is a pointer to the chain to split.
+*
+*               offset   is the number of bytes to keep in 'p_chain', which must be lower than its length.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the chain was split
+*                            OS_ERR_MEM_INVALID_P_MEM  if OSMemBufDescSet() was not called
+*                            OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_chain'
+*                            OS_ERR_MEM_INVALID_SIZE   if 'offset' is 0 or not lower than the length of the chain
+*                            Other                     OS_ERR_xxx returned by OSMemGet() for the descriptor
+*
+* Returns     : A pointer to the second chain if no error is detected
+*               A pointer to NULL if an error is detected, 'p_chain' is then left unchanged.
+*
+* Note(s)     : 1) When 'offset' falls inside a piece, the piece is shared by both chains through a new descriptor and
+*                  a new reference to its message.  No payload byte is copied.
+************************************************************************************************************************
+*/
+
+OS_MEM_BUF  *OSMemBufSplit (OS_MEM_BUF  *p_chain,
+                            CPU_INT32U   offset,
+                            OS_ERR      *p_err)
+{
+    OS_MEM_BUF  *p_buf;
+    OS_MEM_BUF  *p_prev;
+    OS_MEM_BUF  *p_new;
+    CPU_INT32U   pos;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_chain == DEF_NULL) {                                  /* Must split a valid chain                             */
+       *p_err = OS_ERR_PTR_INVALID;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (offset == 0u) {                                         /* The first chain cannot be empty                      */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return (DEF_NULL);
+    }
+
+    p_prev = DEF_NULL;                                          /* Find the piece holding byte 'offset'                 */
+    p_buf  = p_chain;
+    pos    = 0u;
+    while ((p_buf != DEF_NULL) && ((pos + p_buf->Len) <= offset)) {
+        pos   += p_buf->Len;
+        p_prev = p_buf;
+        p_buf  = p_buf->NextPtr;
+    }
+    if (p_buf == DEF_NULL) {                                    /* Offset beyond the end of the chain                   */
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return (DEF_NULL);
+    }
+
+    if (pos == offset) {                                        /* Split between two pieces                             */
+        p_prev->NextPtr = DEF_NULL;
+       *p_err           = OS_ERR_NONE;
+        return (p_buf);
+    }
+
+    if (OSMemBufDescPtr == DEF_NULL) {                          /* Descriptors are set with OSMemBufDescSet()           */
+       *p_err = OS_ERR_MEM_INVALID_P_MEM;
+        return (DEF_NULL);
+    }
+
+    p_new = (OS_MEM_BUF *)OSMemGet(OSMemBufDescPtr, p_err);     /* Split inside a piece (see Note #1)                   */
+    if (p_new == DEF_NULL) {
+        return (DEF_NULL);
+    }
+    OS_MemMsgRefAdd(OS_MEM_MSG_HDR(p_buf->DataPtr), 1u);
+    p_new->NextPtr = p_buf->NextPtr;
+    p_new->DataPtr = p_buf->DataPtr;
+    p_new->Offset  = p_buf->Offset + (OS_MSG_SIZE)(offset - pos);
+    p_new->Len     = p_buf->Len    - (OS_MSG_SIZE)(offset - pos);
+    p_buf->NextPtr = DEF_NULL;
+    p_buf->Len     = (OS_MSG_SIZE)(offset - pos);
+
+   *p_err = OS_ERR_NONE;
+    return (p_new);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           FLUSH THE MAGAZINE OF THE CALLING TASK
+*
+* Description : Returns all the blocks cached in the calling task's magazine to the free list of the partition.  A task
+*               should call this before it is deleted or stops using the partition for a long time.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the magazine was flushed or the partition has none
+*                            OS_ERR_FLUSH_ISR          if you called this function from an ISR
+*                            OS_ERR_MEM_FULL           if the magazine holds blocks that were freed twice
+*                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OBJ_TYPE           if 'p_mem' is not pointing at a memory partition
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+void  OSMemMagFlush (OS_MEM  *p_mem,
+                     OS_ERR  *p_err)
+{
+    OS_MEM_MAG  *p_mag;
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_FLUSH_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_mag = OS_MemMagGet(p_mem);
+    if (p_mag == DEF_NULL) {                                    /* Nothing to flush                                     */
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    OS_MemMagDrain(p_mem, p_mag, p_mag->NbrBlk, p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                           ADD MAGAZINES TO A MEMORY PARTITION
+*
+* Description : Gives a partition one magazine per HWOS context, so that tasks can get and put blocks without touching
+*               the shared free list most of the time (see os_mem.c Note #3).
+*
+* Arguments   : p_mem      is a pointer to the memory partition control block
+*
+*               p_mag_tbl  is a pointer to a table of OS_HWOS_CNTX_CNT magazines, allocated by the application.
+*
+*               p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                if the magazines were added to the partition
+*                              OS_ERR_MEM_INVALID_P_DATA  if you passed a NULL pointer for 'p_mag_tbl'
+*                              OS_ERR_MEM_INVALID_P_MEM   if you passed a NULL pointer for 'p_mem'
+*                              OS_ERR_MEM_INVALID_PART    if the partition already has magazines
+*                              OS_ERR_OBJ_TYPE            if 'p_mem' is not pointing at a memory partition
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function should be called right after OSMemCreate(), before any task uses the partition.
+************************************************************************************************************************
+*/
+
+void  OSMemMagSet (OS_MEM      *p_mem,
+                   OS_MEM_MAG  *p_mag_tbl,
+                   OS_ERR      *p_err)
+{
+    CPU_INT32U  i;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == DEF_NULL) {                                    /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+    if (p_mag_tbl == DEF_NULL) {                                /* Must pass a valid magazine table                     */
+       *p_err  = OS_ERR_MEM_INVALID_P_DATA;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the partition was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_mem->MagTbl != DEF_NULL) {                            /* Magazines cannot be replaced, they may hold blocks   */
+       *p_err = OS_ERR_MEM_INVALID_PART;
+        return;
+    }
+
+    for (i = 0u; i < OS_HWOS_CNTX_CNT; i++) {
+        p_mag_tbl[i].NbrBlk = 0u;
+    }
+    p_mem->MagTbl = p_mag_tbl;
+   *p_err         = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                         GET THE MAGAZINE OF THE CALLING TASK
+*
+* Description : Returns the magazine of the running context, if the caller may use one.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+* Returns     : A pointer to the magazine, or DEF_NULL if the partition has no magazines, if called from an ISR or
+*               before the kernel is started.
+************************************************************************************************************************
+*/
+
+static  OS_MEM_MAG  *OS_MemMagGet (OS_MEM  *p_mem)
+{
+    if ((p_mem->MagTbl  == DEF_NULL) ||
+        (OSIntNestingCtr >  0u)      ||
+        (OSRunning      != 1u)) {
+        return (DEF_NULL);
+    }
+
+    return (&p_mem->MagTbl[OSCtxIDCur]);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 REFILL A MAGAZINE
+*
+* Description : Moves up to OS_MEM_MAG_BATCH blocks from the free list to an empty magazine.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_mag    is a pointer to the magazine of the calling task
+*
+* Returns     : none
+*
+* Note(s)     : 1) The blocks are unlinked before NbrFree is updated, as in OSMemGet().
+************************************************************************************************************************
+*/
+
+static  void  OS_MemMagFill (OS_MEM      *p_mem,
+                             OS_MEM_MAG  *p_mag)
+{
+    void        *p_blk;
+    OS_MEM_QTY   nbr;
+    CPU_INT32U   nbr_free;
+
+
+    nbr = 0u;
+    while (nbr < OS_MEM_MAG_BATCH) {
+        p_blk = OS_CPU_ListPop(&p_mem->FreeListPtr);
+        if (p_blk == DEF_NULL) {
+            break;
+        }
+        p_mag->BlkTbl[nbr] = p_blk;
+        nbr++;
+    }
+
+    if (nbr > 0u) {
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+        OS_MemDbgMagAdd(p_mem, nbr);                            /* Still free, see OS_MemDbgFreeMin() Note #1           */
+#endif
+        do {                                                    /* Account for the whole batch at once                  */
+            nbr_free = p_mem->NbrFree;
+        } while (OS_CPU_CmpSwap(&p_mem->NbrFree, nbr_free, nbr_free - nbr) != DEF_OK);
+    }
+    p_mag->NbrBlk = nbr;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 DRAIN A MAGAZINE
+*
+* Description : Moves the 'nbr' oldest blocks of a magazine back to the free list.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_mag    is a pointer to the magazine of the calling task
+*
+*               nbr      is the number of blocks to drain
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if the blocks were returned to the free list
+*                            OS_ERR_MEM_FULL           if the partition cannot hold 'nbr' more free blocks
+*
+* Returns     : none
+*
+* Note(s)     : 1) The room is reserved in NbrFree before the blocks are linked, as in OSMemPut().
+************************************************************************************************************************
+*/
+
+static  void  OS_MemMagDrain (OS_MEM      *p_mem,
+                              OS_MEM_MAG  *p_mag,
+                              OS_MEM_QTY   nbr,
+                              OS_ERR      *p_err)
+{
+    OS_MEM_QTY  i;
+    CPU_INT32U  nbr_free;
+
+
+    do {                                                        /* Reserve room for the whole batch at once             */
+        nbr_free = p_mem->NbrFree;
+        if ((nbr_free + nbr) > p_mem->NbrMax) {
+           *p_err = OS_ERR_MEM_FULL;
+            return;
+        }
+    } while (OS_CPU_CmpSwap(&p_mem->NbrFree, nbr_free, nbr_free + nbr) != DEF_OK);
+
+    for (i = 0u; i < nbr; i++) {
+        OS_CPU_ListPush(&p_mem->FreeListPtr, p_mag->BlkTbl[i]);
+    }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MemDbgMagAdd(p_mem, (CPU_INT32U)0u - nbr);
+#endif
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+    OS_MemPendPost(p_mem, nbr);
+#endif
+    for (i = nbr; i < p_mag->NbrBlk; i++) {                     /* Keep the most recently freed blocks                  */
+        p_mag->BlkTbl[i - nbr] = p_mag->BlkTbl[i];
+    }
+    p_mag->NbrBlk -= nbr;
+   *p_err          = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          UPDATE THE NUMBER OF WAITING TASKS
+*
+* Description : Atomically adds 'nbr' to the number of tasks in OSMemPend(), use (CPU_INT32U)-1 to remove one.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               nbr      is the number to add
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_PEND_EN == DEF_ENABLED)
+static  void  OS_MemPendCtrAdd (OS_MEM      *p_mem,
+                                CPU_INT32U   nbr)
+{
+    CPU_INT32U  pend_ctr;
+
+
+    do {
+        pend_ctr = p_mem->PendCtr;
+    } while (OS_CPU_CmpSwap(&p_mem->PendCtr, pend_ctr, pend_ctr + nbr) != DEF_OK);
+}
+
+
+/*
+************************************************************************************************************************
+*                                             WAKE UP THE WAITING TASKS
+*
+* Description : Signals the partition semaphore once per released block, up to the number of waiting tasks.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               nbr      is the number of blocks just pushed on the free list
+*
+* Returns     : none
+*
+* Note(s)     : 1) This function can be called from an ISR.  A semaphore overflow is ignored, the waiting tasks are
+*                  then already due to retry.
+************************************************************************************************************************
+*/
+
+static  void  OS_MemPendPost (OS_MEM      *p_mem,
+                              OS_MEM_QTY   nbr)
+{
+    CPU_INT32U  pend_ctr;
+    OS_ERR      err;
+
+
+    pend_ctr = p_mem->PendCtr;
+    if (nbr > pend_ctr) {
+        nbr = (OS_MEM_QTY)pend_ctr;
+    }
+    while (nbr > 0u) {
+        (void)OSSemPost(&p_mem->Sem, OS_OPT_POST_1, &err);
+        nbr--;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                            COUNT A FAILED GET
+*
+* Description : Counts a get that found the partition empty.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+static  void  OS_MemDbgFail (OS_MEM  *p_mem)
+{
+    CPU_INT32U  fail_ctr;
+
+
+    do {
+        fail_ctr = p_mem->DbgFailCtr;
+    } while (OS_CPU_CmpSwap(&p_mem->DbgFailCtr, fail_ctr, fail_ctr + 1u) != DEF_OK);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        UPDATE THE LOWEST NUMBER OF FREE BLOCKS
+*
+* Description : Lowers DbgNbrFreeMin to the number of free blocks, magazines included, if needed.
+*
+* Arguments   : p_mem      is a pointer to the memory partition control block
+*
+*               nbr_free   is the number of free blocks left on the free list by a get
+*
+* Returns     : none
+*
+* Note(s)     : 1) The blocks moved between the free list and a magazine are added to DbgNbrMag before they leave
+*                  NbrFree and removed from it after they reach NbrFree.  A block in transit is thus counted twice
+*                  for a moment, never missed, and cannot lower DbgNbrFreeMin.
+************************************************************************************************************************
+*/
+
+static  void  OS_MemDbgFreeMin (OS_MEM      *p_mem,
+                                CPU_INT32U   nbr_free)
+{
+    CPU_INT32U  nbr_free_min;
+
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+    nbr_free += p_mem->DbgNbrMag;                               /* The blocks in the magazines are free, not used       */
+#endif
+    do {
+        nbr_free_min = p_mem->DbgNbrFreeMin;
+        if (nbr_free >= nbr_free_min) {
+            return;
+        }
+    } while (OS_CPU_CmpSwap(&p_mem->DbgNbrFreeMin, nbr_free_min, nbr_free) != DEF_OK);
+}
+
+
+/*
+************************************************************************************************************************
+*                                   UPDATE THE NUMBER OF BLOCKS HELD IN MAGAZINES
+*
+* Description : Atomically adds 'nbr' to DbgNbrMag, use (CPU_INT32U)-1 to remove one.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               nbr      is the number to add
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_MAG_EN == DEF_ENABLED)
+static  void  OS_MemDbgMagAdd (OS_MEM      *p_mem,
+                               CPU_INT32U   nbr)
+{
+    CPU_INT32U  nbr_mag;
+
+
+    do {
+        nbr_mag = p_mem->DbgNbrMag;
+    } while (OS_CPU_CmpSwap(&p_mem->DbgNbrMag, nbr_mag, nbr_mag + nbr) != DEF_OK);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              RECORD THE OWNER OF A BLOCK
+*
+* Description : Records the context that got a block, or marks it free, if the partition has an owner table.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_blk    is a pointer to the memory block
+*
+*               got      DEF_YES if the block was just got, DEF_NO if it is being released.
+*
+* Returns     : none
+*
+* Note(s)     : 1) A block outside of the partition is ignored, OSMemPut() does not check 'p_blk'.
+************************************************************************************************************************
+*/
+
+static  void  OS_MemDbgOwnerSet (OS_MEM       *p_mem,
+                                 void         *p_blk,
+                                 CPU_BOOLEAN   got)
+{
+    CPU_ADDR    offset;
+    CPU_INT08U  owner;
+
+
+    if (p_mem->DbgOwnerTbl == DEF_NULL) {
+        return;
+    }
+
+    offset = (CPU_ADDR)p_blk - (CPU_ADDR)p_mem->AddrPtr;
+    if (offset >= ((CPU_ADDR)p_mem->NbrMax * p_mem->BlkSize)) {
+        return;
+    }
+
+    if (got == DEF_NO) {
+        owner = OS_MEM_OWNER_NONE;
+    } else if ((OSIntNestingCtr > 0u) || (OSRunning != 1u)) {
+        owner = OS_MEM_OWNER_ISR;
+    } else {
+        owner = (CPU_INT08U)OSCtxIDCur;
+    }
+    p_mem->DbgOwnerTbl[offset / p_mem->BlkSize] = owner;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                          UPDATE THE OWNERS OF A MESSAGE
+*
+* Description : Atomically adds 'nbr' to the number of owners of a message, use (CPU_INT32U)-1 to remove one.
+*
+* Arguments   : p_msg    is a pointer to the message header
+*
+*               nbr      is the number to add
+*
+* Returns     : none
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_MSG_EN == DEF_ENABLED)
+static  void  OS_MemMsgRefAdd (OS_MEM_MSG  *p_msg,
+                               CPU_INT32U   nbr)
+{
+    CPU_INT32U  ref_ctr;
+
+
+    do {
+        ref_ctr = p_msg->RefCtr;
+    } while (OS_CPU_CmpSwap(&p_msg->RefCtr, ref_ctr, ref_ctr + nbr) != DEF_OK);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           ADD MEMORY PARTITION TO DEBUG LIST
+*
+* Description : This function is called by OSMemCreate() to add the memory partition to the debug table.
+*
+* Arguments   : p_mem    Is a pointer to the memory partition
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void  OS_MemDbgListAdd (OS_MEM  *p_mem)
+{
+    p_mem->DbgPrevPtr               = DEF_NULL;
+    if (OSMemDbgListPtr == DEF_NULL) {
+        p_mem->DbgNextPtr           = DEF_NULL;
+    } else {
+        p_mem->DbgNextPtr           =  OSMemDbgListPtr;
+        OSMemDbgListPtr->DbgPrevPtr =  p_mem;
+    }
+    OSMemDbgListPtr                 =  p_mem;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                           INITIALIZE MEMORY PARTITION MANAGER
+*
+* Description : This function is called by uC/OS-III to initialize the memory partition manager.  Your
+*               application MUST NOT call this function.
+*
+* Arguments   : none
+*
+* Returns     : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_MemInit (OS_ERR  *p_err)
+{
+#if (OS_CFG_MEM_SLAB_EN == DEF_ENABLED)
+    CPU_INT08U  bucket;
+
+
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OSMemDbgListPtr = DEF_NULL;
+#endif
+
+#if (OS_CFG_MEM_BUF_EN == DEF_ENABLED)
+    OSMemBufDescPtr   = DEF_NULL;                               /* Set by OSMemBufDescSet()                             */
+#endif
+
+#if (OS_CFG_MEM_SLAB_EN == DEF_ENABLED)
+    OSMemSlabClassNbr = 0u;                                     /* No size class yet                                    */
+    for (bucket = 0u; bucket <= DEF_INT_CPU_NBR_BITS; bucket++) {
+        OSMemSlabClassTbl[bucket] = 0u;
+    }
 #endif
 
     OSMemQty        = 0u;
@@ -125,6 +125,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 
     p_mutex->SemID = sem_id;
     p_mutex->Mutex = DEF_YES;
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatClr(&p_mutex->Stat);
+#endif
     OSSemPtrTbl[i] = (OS_SEM *)p_mutex;
 
     RIN32_HWOS->SEM_TBL[sem_id] = DEF_BIT_18 | 0x00000040;
@@ -134,6 +137,7 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 #endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(sem_id | DEF_BIT_16);                        /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_R5(1u);
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CRE_SEM);
@@ -210,6 +214,10 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
                    CPU_TS    *p_ts,
                    OS_ERR    *p_err)
 {
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    CPU_TS       ts_start;
+    CPU_BOOLEAN  blocked;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -257,20 +265,41 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 
     if (opt & OS_OPT_PEND_NON_BLOCKING) {
         timeout = 0u;
+    } else if (OSSchedLockNestingCtr > 0u) {
+        timeout = 0u;                                           /* Can't block while the scheduler is locked.           */
+    } else {
+        OS_SchedFlush();                                        /* Release a deferred switch before blocking.           */
     }
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    ts_start = CPU_TS_Get32();
+#endif
+    OSTaskTCBPtrTbl[OSCtxIDCur]->MutexCtr++;                    /* Counted from the pend on, see OSTaskSuspend().       */
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_mutex->SemID);                             /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_R5(timeout);                                    /* Timeout.                                             */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_WAI_SEM);
 
     OS_HWOS_CMD_PROC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    blocked = OS_ObjStatPend(&p_mutex->Stat);                   /* Count the pend before the task is switched out.      */
+#endif
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatPendEnd(&p_mutex->Stat, blocked, ts_start, OSTaskRet[OSCtxIDCur].r0 & OS_HWOS_RESP_MASK);
+#endif
+
+    if ((OSTaskRet[OSCtxIDCur].r0 != 0x0001u) &&
+        (OSTaskRet[OSCtxIDCur].r0 != 0x0003u)) {
+        OSTaskTCBPtrTbl[OSCtxIDCur]->MutexCtr--;                /* The mutex was not obtained.                          */
+    }
+
     switch (OSTaskRet[OSCtxIDCur].r0) {
         case 0x0001:                                            /* Success.                                             */
         case 0x0003:                                            /* Success.                                             */
@@ -278,7 +307,11 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
              break;
 
         case 0x0004:                                            /* Would block.                                         */
-            *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+                *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             } else {
+                *p_err = OS_ERR_SCHED_LOCKED;                   /* Polled since the scheduler is locked.                */
+             }
              break;
 
         case 0xFF86:                                            /* Timeout.                                             */
@@ -319,6 +352,9 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 *
 *                       OS_OPT_POST_NONE        No special option selected
 *                       OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*                                               The context switch is then held until OSSched() is called,
+*                                               the calling task blocks, or it calls the kernel for anything
+*                                               else than another post with that option.
 *
 *              p_err    is a pointer to a variable that will contain an error code returned by this function.
 *
@@ -366,13 +402,21 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+    OS_PRIO_SCHED_ENTER();                                      /* Order the readied tasks before dispatching them.     */
+    OS_OBJ_STAT_POST(p_mutex);
+
+    if ((opt & OS_OPT_POST_NO_SCHED) != 0u) {
+        OS_SchedDefer();                                        /* Hold the switch for the posting sequence.            */
+    }
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_mutex->SemID);                             /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SIG_SEM);
 
     OS_HWOS_CMD_PROC_ISR(ret_val);
 
+    OS_PRIO_SCHED_EXIT(ret_val);
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
@@ -382,6 +426,9 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
     switch (ret_val) {
         case 0x0001:                                            /* Success.                                             */
+             if (OSTaskTCBPtrTbl[OSCtxIDCur]->MutexCtr > 0u) {
+                 OSTaskTCBPtrTbl[OSCtxIDCur]->MutexCtr--;       /* See OSTaskSuspend().                                 */
+             }
             *p_err = OS_ERR_NONE;
              break;
 
@@ -481,6 +528,7 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 #endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_mutex->SemID);
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_DEL_SEM);
 
@@ -0,0 +1,570 @@
+/*
+*********************************************************************************************************
+*                                           uC/OS-III HW-RTOS
+*
+*                         (c) Copyright 2004-2014; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/OS-III-HWOS is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: www.micrium.com
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                        PRIORITY MANAGEMENT
+*
+* Filename      : os_prio.c
+*
+* Note(s)       : (1) When OS_CFG_PRIO_MAX is larger than the number of HWOS priorities, the logical task
+*                     priorities are folded onto the HWOS priority bands by OS_PRIO_TO_HW().  The HWOS keeps
+*                     the ready tasks of a band in FIFO order, so the functions below re-queue the tasks of a
+*                     band, in logical priority order, whenever a task joins it.  Tasks of the same logical
+*                     priority are kept in the order they became ready.
+*
+*                 (2) A task is re-queued by moving it to another band and back, which places it at the tail
+*                     of its band.  This is done with HWOS dispatching disabled, so the HWOS picks the head of
+*                     the band only once the band is sorted.
+*
+*                 (3) Only the tasks that may have changed state are looked at.  OSPrioRdyTbl[] holds the
+*                     ready tasks already ordered within their band, OSPrioChkTbl[] the tasks that may have
+*                     become ready since: the tasks that blocked (see OS_PrioCtxSwOut()), were created,
+*                     changed priority or yielded.  A band is only re-queued from the first task that is out
+*                     of order, so a task that joins a band at its place issues no HWOS command.
+*
+*                 (4) The tasks readied by the posts are ordered before the post returns.  The tasks readied
+*                     by the HWOS on its own (timeouts, HW ISRs, deleted objects) are ordered by
+*                     OS_PrioSchedChk() on the next context switch, whoever requests it, and at the latest on
+*                     the next OS tick.  Nothing is done as long as none of them became ready.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_PrioIsRdy    (CPU_INT32U   ctx_id);
+
+static  CPU_BOOLEAN  OS_PrioIsDirty  (void);
+
+static  CPU_BOOLEAN  OS_PrioIsBefore (OS_TCB      *p_tcb1,
+                                      OS_TCB      *p_tcb2);
+
+static  void         OS_PrioBandSort (CPU_INT32U   band,
+                                      CPU_INT32U  *p_new_tbl);
+
+static  void         OS_PrioRequeue  (CPU_INT32U   ctx_id,
+                                      CPU_INT32U   band);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          INTERNAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                 INITIALIZE THE SUB-PRIORITY SCHEDULER
+*
+* Description: This function is called by OSInit() to initialize the sub-priority scheduler.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*********************************************************************************************************
+*/
+
+void  OS_PrioInit (void)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        OSPrioRdyTbl[i] = 0u;
+        OSPrioChkTbl[i] = 0u;
+    }
+
+    OSPrioSeqCtr = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                   ORDER THE TASKS WITHIN THEIR BAND
+*
+* Description: This function looks for the tasks that became ready since the last call and re-queues the bands
+*              they joined in logical priority order.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts and HWOS dispatching disabled.  It is called by
+*                 OS_DispatchEn() before dispatching is enabled again.
+*
+*              3) Only the tasks of OSPrioChkTbl[] are looked at, see Note #3 at the top of this file.
+*********************************************************************************************************
+*/
+
+void  OS_PrioSched (void)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   new_tbl[OS_PRIO_TBL_SIZE];
+    CPU_INT32U   band_tbl;
+    CPU_INT32U   band;
+    CPU_INT32U   chk;
+    CPU_INT32U   ctx_id;
+    CPU_INT32U   bit;
+    CPU_INT32U   i;
+
+
+    band_tbl = 0u;
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        new_tbl[i] = 0u;
+        chk        = OSPrioChkTbl[i];
+        while (chk != 0u) {
+            bit     = CPU_CntTrailZeros(chk);
+            chk    &= ~DEF_BIT(bit);
+            ctx_id  = (i * 32u) + bit;
+            p_tcb   = OSTaskTCBPtrTbl[ctx_id];
+
+            if ((p_tcb == DEF_NULL) ||                          /* Task deleted.                                        */
+                (p_tcb == &OSIdleTaskTCB)) {
+                OSPrioChkTbl[i] &= ~DEF_BIT(bit);
+                continue;
+            }
+
+            if (OS_PrioIsRdy(ctx_id) == DEF_NO) {               /* Still waiting.                                       */
+                continue;
+            }
+
+            OSPrioChkTbl[i] &= ~DEF_BIT(bit);                   /* Task became ready since the last call.               */
+            new_tbl[i]      |=  DEF_BIT(bit);
+            OSPrioSeqCtr++;
+            p_tcb->PrioSeq   = OSPrioSeqCtr;
+            band_tbl        |= DEF_BIT(OS_PRIO_TO_HW(p_tcb->Prio));
+        }
+    }
+
+    while (band_tbl != 0u) {                                    /* Sort the bands that were joined.                     */
+        band      = CPU_CntTrailZeros(band_tbl);
+        band_tbl &= ~DEF_BIT(band);
+        OS_PrioBandSort(band, &new_tbl[0]);
+    }
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        OSPrioRdyTbl[i] |= new_tbl[i];
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                            ORDER THE TASKS READIED BY THE HWOS ON ITS OWN
+*
+* Description: This function orders, within their band, the tasks that the HWOS readied without a command
+*              from the kernel, if there are any.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.  It is called by the OS tick, by
+*                 OS_PrioCtxSwOut() and by the port when the HWOS requests a context switch by itself.
+*
+*              3) The commands are issued as from an ISR, so that their results are not handed over to the
+*                 current task.  A switch to the task now at the head of its band is pended.
+*********************************************************************************************************
+*/
+
+void  OS_PrioSchedChk (void)
+{
+    if (OS_PrioIsDirty() == DEF_NO) {                           /* No band to re-queue.                                 */
+        return;
+    }
+
+    OSIntNestingCtr++;                                          /* See Note #3.                                         */
+    OS_DispatchDis();                                           /* Re-enabling dispatching orders the bands.            */
+    OS_DispatchEn();
+    OSIntNestingCtr--;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        MARK A TASK AS NEWLY READY
+*
+* Description: This function makes the next call to OS_PrioSched() handle the task as if it just became ready.
+*              It is used when the task is created, its priority is changed or it may have blocked.
+*
+* Arguments  : ctx_id    is the HWOS context id of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+void  OS_PrioRdyClr (CPU_INT32U  ctx_id)
+{
+    OSPrioRdyTbl[ctx_id / 32u] &= ~DEF_BIT(ctx_id % 32u);
+    OSPrioChkTbl[ctx_id / 32u] |=  DEF_BIT(ctx_id % 32u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   NOTE A TASK SWITCHED OUT BY A COMMAND
+*
+* Description: This function is called by OS_HWOS_CMD_PROC() and OS_HWOS_CMD_PROC_ISR() when the HWOS switches
+*              away from the task that issued the command.  If the task blocked, it is looked at again by
+*              OS_PrioSched() until it is ready.
+*
+* Arguments  : ctx_id    is the HWOS context id of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled, before the switch is performed.
+*
+*              3) The HWOS picked the head of a band that may have been joined by tasks it readied on its own.
+*                 They are ordered before the switch is performed.
+*********************************************************************************************************
+*/
+
+void  OS_PrioCtxSwOut (CPU_INT32U  ctx_id)
+{
+    if (ctx_id >= OS_HWOS_CNTX_CNT) {                           /* Multitasking not started yet.                        */
+        return;
+    }
+
+    if (OS_PrioIsRdy(ctx_id) == DEF_NO) {                       /* Task preempted while ready keeps its place.          */
+        OS_PrioRdyClr(ctx_id);
+    }
+
+    OS_PrioSchedChk();                                          /* See Note #3.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                 MOVE A TASK BEHIND ITS PRIORITY PEERS
+*
+* Description: This function moves a task behind the other ready tasks of the same logical priority.  It
+*              replaces the rotation of the ready queue for round-robin scheduling, which would otherwise
+*              rotate all the logical priorities sharing the band.
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task.
+*
+* Returns    : DEF_YES   if the task was moved.
+*              DEF_NO    if no other task is ready at the same logical priority.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts and HWOS dispatching disabled.  The task is
+*                 moved to the tail of its band here and put back in order by OS_PrioSched() when
+*                 dispatching is enabled again.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_PrioYield (OS_TCB  *p_tcb)
+{
+    OS_TCB      *p_tcb_peer;
+    CPU_INT32U   rdy;
+    CPU_INT32U   ctx_id;
+    CPU_INT32U   bit;
+    CPU_INT32U   i;
+
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {                   /* Look for a peer among the ordered ready tasks.       */
+        rdy = OSPrioRdyTbl[i];
+        while (rdy != 0u) {
+            bit         = CPU_CntTrailZeros(rdy);
+            rdy        &= ~DEF_BIT(bit);
+            ctx_id      = (i * 32u) + bit;
+            p_tcb_peer  = OSTaskTCBPtrTbl[ctx_id];
+            if ((ctx_id != p_tcb->CtxID) &&
+                (OS_PrioIsRdy(ctx_id) == DEF_YES) &&
+                (p_tcb_peer->Prio == p_tcb->Prio)) {
+                OS_PrioRequeue(p_tcb->CtxID, OS_PRIO_TO_HW(p_tcb->Prio));
+                OS_PrioRdyClr(p_tcb->CtxID);
+                return (DEF_YES);
+            }
+        }
+    }
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                      CHECK IF A TASK IS READY
+*
+* Description: This function checks if an application task is ready or running.
+*
+* Arguments  : ctx_id    is the HWOS context id of the task.
+*
+* Returns    : DEF_YES   if the task is ready or running.
+*              DEF_NO    otherwise, or if the context is free, or runs the idle task.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_PrioIsRdy (CPU_INT32U  ctx_id)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT32U   stat;
+
+
+    p_tcb = OSTaskTCBPtrTbl[ctx_id];
+    if ((p_tcb == DEF_NULL) ||
+        (p_tcb == &OSIdleTaskTCB)) {
+        return (DEF_NO);
+    }
+
+    stat = OS_HWOS_GET_CNTX_STAT(ctx_id);
+    if ((stat != OS_HWOS_CNTS_STAT_RDY) &&
+        (stat != OS_HWOS_CNTX_STAT_RUN)) {
+        return (DEF_NO);
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                CHECK IF A BAND MUST BE RE-QUEUED
+*
+* Description: This function checks if one of the tasks that may have changed state became ready since the
+*              last call to OS_PrioSched().
+*
+* Arguments  : none
+*
+* Returns    : DEF_YES   if a task of OSPrioChkTbl[] is ready.
+*              DEF_NO    otherwise.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_PrioIsDirty (void)
+{
+    CPU_INT32U  chk;
+    CPU_INT32U  bit;
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
+        chk = OSPrioChkTbl[i];
+        while (chk != 0u) {
+            bit  = CPU_CntTrailZeros(chk);
+            chk &= ~DEF_BIT(bit);
+            if (OS_PrioIsRdy((i * 32u) + bit) == DEF_YES) {
+                return (DEF_YES);
+            }
+        }
+    }
+
+    return (DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    COMPARE THE ORDER OF TWO TASKS
+*
+* Description: This function checks if a task must run before another task of the same band.
+*
+* Arguments  : p_tcb1    is a pointer to the TCB of the first task.
+*
+*              p_tcb2    is a pointer to the TCB of the second task.
+*
+* Returns    : DEF_YES   if the first task has a higher logical priority, or the same logical priority and
+*                        became ready earlier.
+*              DEF_NO    otherwise.
+*
+* Note(s)    : 1) The ready sequence numbers are compared by difference so that the counter may wrap.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_PrioIsBefore (OS_TCB  *p_tcb1,
+                                      OS_TCB  *p_tcb2)
+{
+    if (p_tcb1->Prio != p_tcb2->Prio) {
+        return ((p_tcb1->Prio < p_tcb2->Prio) ? DEF_YES : DEF_NO);
+    }
+
+    return (((CPU_INT32S)(p_tcb1->PrioSeq - p_tcb2->PrioSeq) < 0) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     RE-QUEUE THE TASKS OF A BAND
+*
+* Description: This function re-queues the ready tasks of an HWOS priority band in logical priority order.
+*
+* Arguments  : band      is the HWOS priority band to sort.
+*
+*              p_new_tbl is a pointer to the table of the tasks that just became ready.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called with interrupts and HWOS dispatching disabled.
+*
+*              2) The tasks of OSPrioRdyTbl[] are at the head of the band, in order, and the HWOS appended
+*                 the tasks that just became ready at its tail.  Only the tasks from the first one that just
+*                 became ready, in logical priority order, are re-queued.  None is when a single task joined
+*                 the band and it is last in order.
+*
+*              3) A task of OSPrioRdyTbl[] found not ready was suspended or deleted by another task, it is
+*                 looked at again by the next calls to OS_PrioSched().
+*
+*              4) Changing the priority of a task that holds a mutex does not undo the priority inheritance
+*                 applied by the HWOS, the task keeps running at the inherited priority.
+*********************************************************************************************************
+*/
+
+static  void  OS_PrioBandSort (CPU_INT32U   band,
+                               CPU_INT32U  *p_new_tbl)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT08U   ctx_tbl[OS_HWOS_CNTX_CNT];
+    CPU_INT32U   nbr;
+    CPU_INT32U   rdy;
+    CPU_INT32U   ctx_id;
+    CPU_INT32U   bit;
+    CPU_INT32U   i;
+    CPU_INT32U   j;
+
+
+    nbr = 0u;
+    for (j = 0u; j < OS_PRIO_TBL_SIZE; j++) {
+        rdy = OSPrioRdyTbl[j] | p_new_tbl[j];
+        while (rdy != 0u) {
+            bit     = CPU_CntTrailZeros(rdy);
+            rdy    &= ~DEF_BIT(bit);
+            ctx_id  = (j * 32u) + bit;
+
+            if (OS_PrioIsRdy(ctx_id) == DEF_NO) {               /* See Note #3.                                         */
+                OS_PrioRdyClr(ctx_id);
+                continue;
+            }
+
+            p_tcb = OSTaskTCBPtrTbl[ctx_id];
+            if (OS_PRIO_TO_HW(p_tcb->Prio) != band) {
+                continue;
+            }
+
+            i = nbr;                                            /* Insert the task in order.                            */
+            while ((i > 0u) &&
+                   (OS_PrioIsBefore(p_tcb, OSTaskTCBPtrTbl[ctx_tbl[i - 1u]]) == DEF_YES)) {
+                ctx_tbl[i] = ctx_tbl[i - 1u];
+                i--;
+            }
+            ctx_tbl[i] = (CPU_INT08U)ctx_id;
+            nbr++;
+        }
+    }
+
+    for (i = 0u; i < nbr; i++) {                                /* Find the first task that just became ready.          */
+        ctx_id = ctx_tbl[i];
+        if ((p_new_tbl[ctx_id / 32u] & DEF_BIT(ctx_id % 32u)) != 0u) {
+            break;
+        }
+    }
+
+    if ((nbr - i) < 2u) {                                       /* The new task, if any, already is at the tail.        */
+        return;
+    }
+
+    for (; i < nbr; i++) {
+        OS_PrioRequeue(ctx_tbl[i], band);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                   MOVE A TASK TO THE TAIL OF ITS BAND
+*
+* Description: This function moves a ready task to the tail of its HWOS priority band.
+*
+* Arguments  : ctx_id    is the HWOS context id of the task.
+*
+*              band      is the HWOS priority band of the task.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called with interrupts and HWOS dispatching disabled.
+*********************************************************************************************************
+*/
+
+static  void  OS_PrioRequeue (CPU_INT32U  ctx_id,
+                              CPU_INT32U  band)
+{
+    CPU_INT32U  resp;
+
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(ctx_id);                                     /* Move the task out of the band ...                    */
+    OS_HWOS_SET_R5((band == 0u) ? 1u : 0u);
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CHG_PRI);
+
+    OS_HWOS_CMD_WAIT(resp);
+
+    OS_HWOS_SET_R4(ctx_id);                                     /* ... and back to its tail.                            */
+    OS_HWOS_SET_R5(band);
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CHG_PRI);
+
+    OS_HWOS_CMD_WAIT(resp);
+    (void)&resp;
+}
+#endif
@@ -128,10 +128,14 @@ void  OSQCreate (OS_Q        *p_q,
     }
 
     p_q->QID = q_id;
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatClr(&p_q->Stat);
+#endif
     OSQPtrTbl[q_id] = p_q;
 
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(q_id);                                       /* HWOS mail box ID.                                    */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CRE_MBX);
 
@@ -171,24 +175,32 @@ void  OSQCreate (OS_Q        *p_q,
 *
 *              opt           determines the type of POST performed:
 *
-*                            OS_OPT_POST_ALL*         POST to ALL tasks that are waiting on the queue.  This option
-*                                                     can be added to either OS_OPT_POST_FIFO or OS_OPT_POST_LIFO
-*                            OS_OPT_POST_FIFO*        POST message to end of queue (FIFO) and wake up a single
+*                            OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue.  This option
+*                                                     can be added to OS_OPT_POST_FIFO
+*                            OS_OPT_POST_FIFO         POST message to end of queue (FIFO) and wake up a single
 *                                                     waiting task.
-*                            OS_OPT_POST_LIFO*        POST message to the front of the queue (LIFO) and wake up
-*                                                     a single waiting task.
-*                            OS_OPT_POST_NO_SCHED*    Do not call the scheduler
-*
-*                            * Not supported by the HWOS, options silently ignored.
+*                            OS_OPT_POST_NO_SCHED     Do not call the scheduler
 *
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE            The call was successful and the message was sent
 *                                OS_ERR_OBJ_PTR_NULL    If 'p_q' is a NULL pointer
 *                                OS_ERR_OBJ_TYPE        If the message queue was not initialized
+*                                OS_ERR_OPT_INVALID     If you specified an invalid option, or OS_OPT_POST_LIFO
 *                                OS_ERR_Q_MAX           If the queue is full
 *
 * Returns    : None
+*
+* Note(s)    : 1) The HWOS mail boxes are FIFO only.  Posting to the front of a queue would take two HWOS
+*                 commands per message already in the queue, with interrupts disabled, so OS_OPT_POST_LIFO is
+*                 rejected.
+*
+*              2) OS_OPT_POST_ALL is processed with HWOS dispatching disabled so that at most one context switch
+*                 is requested, once the post is complete.
+*
+*              3) With OS_OPT_POST_NO_SCHED, the context switch is held until OSSched() is called, the calling
+*                 task blocks, or it calls the kernel for anything else than another post with that option.
+*                 The option is ignored when posting from an ISR.
 *********************************************************************************************************
 */
 
@@ -212,8 +224,25 @@ void  OSQPost (OS_Q         *p_q,
        *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
+
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
 #endif
 
+    if ((opt & OS_OPT_POST_LIFO) != 0u) {                       /* See Note #1.                                         */
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+
 #if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
     if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure queue was created                          */
        *p_err = OS_ERR_OBJ_TYPE;
@@ -223,14 +252,28 @@ void  OSQPost (OS_Q         *p_q,
 
 
     CPU_CRITICAL_ENTER();
+    OS_PRIO_SCHED_ENTER();                                      /* Order the readied tasks before dispatching them.     */
+    OS_OBJ_STAT_POST(p_q);
 
+    if ((opt & OS_OPT_POST_NO_SCHED) != 0u) {
+        OS_SchedDefer();                                        /* Hold the switch for the posting sequence.            */
+    }
+
+    if ((opt & OS_OPT_POST_ALL) != 0u) {
+        OS_DispatchDis();                                       /* Complete the post before switching.                  */
+        ret_val = OS_QPostAll(p_q, p_void);
+        OS_DispatchEn();
+    } else {
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
-    OS_HWOS_SET_R4(p_q->QID);                                   /* HWOS Mail Box ID.                                    */
-    OS_HWOS_SET_R5((CPU_INT32U)p_void);                         /* Message.                                             */
-    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SND_MBX);
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_R4(p_q->QID);                               /* HWOS Mail Box ID.                                    */
+        OS_HWOS_SET_R5((CPU_INT32U)p_void);                     /* Message.                                             */
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SND_MBX);
 
-    OS_HWOS_CMD_PROC_ISR(ret_val);
+        OS_HWOS_CMD_PROC_ISR(ret_val);
+    }
 
+    OS_PRIO_SCHED_EXIT(ret_val);
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
@@ -259,6 +302,96 @@ void  OSQPost (OS_Q         *p_q,
 #endif /* OS_CFG_Q_EN == DEF_ENABLED */
 
 
+/*
+*********************************************************************************************************
+*                                     POST MESSAGE TO A QUEUE ASYNCHRONOUSLY
+*
+* Description: This function sends a message to a queue without waiting for the HWOS to complete the post.  The
+*              caller keeps running while the HWOS processes the command.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate().
+*
+*              p_void        is a pointer to the message to send.
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE            The post was issued
+*                                OS_ERR_OBJ_PTR_NULL    If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE        If the message queue was not initialized
+*                                OS_ERR_POST_ISR        If you called this function from an ISR
+*
+* Returns    : None
+*
+* Note(s)    : 1) The message is posted in FIFO order.
+*
+*              2) The result of the post is collected by the next HWOS command, see OS_PostAsyncCollect().  A
+*                 post to a full or deleted queue is reported by the next call to OSPostAsyncCollect().
+*
+*              3) The context switch is held while the HWOS processes the post, and only until the next call to
+*                 the kernel made by the calling task, which also collects the result.  OSSched(),
+*                 OSPostAsyncCollect() or blocking release it as well.
+*********************************************************************************************************
+*/
+
+#if ((OS_CFG_Q_EN == DEF_ENABLED) && (OS_CFG_POST_ASYNC_EN == DEF_ENABLED))
+void  OSQPostAsync (OS_Q         *p_q,
+                    void         *p_void,
+                    OS_MSG_SIZE   msg_size,
+                    OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+    (void)&msg_size;                                            /* The HWOS mail box only carries the pointer.          */
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_q == DEF_NULL) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure queue was created                          */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+
+    CPU_CRITICAL_ENTER();
+    OS_SchedDefer();                                            /* Hold the switch, see Note #3.                        */
+    OS_OBJ_STAT_POST(p_q);
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(p_q->QID);                                   /* HWOS Mail Box ID.                                    */
+    OS_HWOS_SET_R5((CPU_INT32U)p_void);                         /* Message.                                             */
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SND_MBX);
+
+    OSPostAsyncCtxID = OSCtxIDCur;                              /* Don't wait for the result, see Note #2.              */
+    OSPostAsyncCmd   = OS_HWOS_TSFNC_SND_MBX;
+    OSPostAsyncPend  = DEF_YES;
+    CPU_CRITICAL_EXIT();
+    OS_SCHED_DEFER_CHK();                                       /* Release the switch on the next call, see Note #3.    */
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            PEND ON A QUEUE FOR A MESSAGE
@@ -313,6 +446,10 @@ void  *OSQPend (OS_Q         *p_q,
                 CPU_TS       *p_ts,
                 OS_ERR       *p_err)
 {
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    CPU_TS       ts_start;
+    CPU_BOOLEAN  blocked;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -360,18 +497,35 @@ void  *OSQPend (OS_Q         *p_q,
 
     if (opt & OS_OPT_PEND_NON_BLOCKING) {
         timeout = 0u;
+    } else if (OSSchedLockNestingCtr > 0u) {
+        timeout = 0u;                                           /* Can't block while the scheduler is locked.           */
+    } else {
+        OS_SchedFlush();                                        /* Release a deferred switch before blocking.           */
     }
 
+    CPU_CRITICAL_ENTER();
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    ts_start = CPU_TS_Get32();
+#endif
+
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_q->QID);                                   /* HWOS Mail Box ID.                                    */
     OS_HWOS_SET_R5(timeout);                                    /* Timeout.                                             */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_RCV_MBX);
 
     OS_HWOS_CMD_PROC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    blocked = OS_ObjStatPend(&p_q->Stat);                       /* Count the pend before the task is switched out.      */
+#endif
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatPendEnd(&p_q->Stat, blocked, ts_start, OSTaskRet[OSCtxIDCur].r0 & OS_HWOS_RESP_MASK);
+#endif
+
     switch (OSTaskRet[OSCtxIDCur].r0 & 0x000FFFFu) {
         case 0x0001:                                            /* Success.                                             */
         case 0x0003:                                            /* Success.                                             */
@@ -379,7 +533,11 @@ void  *OSQPend (OS_Q         *p_q,
              break;
 
         case 0x0004:                                            /* Would block.                                         */
-            *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+                *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             } else {
+                *p_err = OS_ERR_SCHED_LOCKED;                   /* Polled since the scheduler is locked.                */
+             }
              break;
 
         case 0xFF86:                                            /* Timeout.                                             */
@@ -485,6 +643,7 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 #endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_q->QID);                                   /* HWOS Mail Box ID.                                    */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_DEL_MBX);
 
@@ -509,3 +668,114 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     return (0u);
 }
 #endif /* (OS_CFG_Q_EN == DEF_ENABLED) &&  (OS_CFG_Q_DEL_EN == DEF_ENABLED) */
+
+
+/*
+*********************************************************************************************************
+*                                    BROADCAST A MESSAGE TO A QUEUE
+*
+* Description: This function sends a message to every task waiting on a queue.  The HWOS delivers a message
+*              to a single waiting task, so the message is sent again for as long as each send readies one of
+*              the tasks still waiting on the queue.
+*
+* Arguments  : p_q       is a pointer to the message queue.
+*
+*              p_void    is a pointer to the message to send.
+*
+* Returns    : The HWOS response code of the post.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts and HWOS dispatching disabled.
+*
+*              3) The waiting contexts are checked again before each send, so a wait that timed out since the
+*                 previous send is not counted.  A send is assumed to have readied a waiting task when one of the
+*                 contexts still waiting just before it leaves the wait state.  Since a queue with waiting tasks
+*                 is always empty, any copy left in the queue at the end is removed.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+CPU_INT32U  OS_QPostAll (OS_Q  *p_q,
+                         void  *p_void)
+{
+    CPU_INT32U   wait_tbl[OS_HWOS_CNTX_CNT / 32u];
+    CPU_INT32U   wait_msk;
+    CPU_INT32U   ctx_id;
+    CPU_INT32U   nbr_rdy;
+    CPU_INT32U   resp;
+    CPU_INT32U   ix;
+    CPU_INT32U   bit;
+    CPU_BOOLEAN  rdy;
+
+
+    for (ix = 0u; ix < (OS_HWOS_CNTX_CNT / 32u); ix++) {        /* Take a snapshot of the waiting contexts.             */
+        wait_tbl[ix] = 0u;
+        for (bit = 0u; bit < 32u; bit++) {
+            if (OS_HWOS_GET_CNTX_STAT((ix * 32u) + bit) == OS_HWOS_CNTX_STAT_WAIT) {
+                wait_tbl[ix] |= DEF_BIT(bit);
+            }
+        }
+    }
+
+    resp    = 0x0001u;
+    nbr_rdy = 0u;
+    rdy     = DEF_YES;
+    while (rdy == DEF_YES) {
+        wait_msk = 0u;
+        for (ix = 0u; ix < (OS_HWOS_CNTX_CNT / 32u); ix++) {    /* Drop the contexts that stopped waiting meanwhile.    */
+            for (bit = 0u; bit < 32u; bit++) {
+                if (((wait_tbl[ix] & DEF_BIT(bit)) != 0u) &&
+                    (OS_HWOS_GET_CNTX_STAT((ix * 32u) + bit) != OS_HWOS_CNTX_STAT_WAIT)) {
+                    wait_tbl[ix] &= ~DEF_BIT(bit);
+                }
+            }
+            wait_msk |= wait_tbl[ix];
+        }
+        if ((nbr_rdy != 0u) && (wait_msk == 0u)) {              /* Every waiting task got the message.                  */
+            break;
+        }
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_R4(p_q->QID);                               /* HWOS Mail Box ID.                                    */
+        OS_HWOS_SET_R5((CPU_INT32U)p_void);                     /* Message.                                             */
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SND_MBX);
+
+        OS_HWOS_CMD_WAIT(resp);
+
+        if (resp != 0x0001u) {                                  /* Queue full or invalid mail box.                      */
+            break;
+        }
+
+        rdy = DEF_NO;                                           /* Find the waiting context readied by this send.       */
+        for (ix = 0u; (ix < (OS_HWOS_CNTX_CNT / 32u)) && (rdy == DEF_NO); ix++) {
+            wait_msk = wait_tbl[ix];
+            while (wait_msk != 0u) {
+                bit      = CPU_CntTrailZeros(wait_msk);
+                wait_msk = wait_msk & ~DEF_BIT(bit);
+                ctx_id   = (ix * 32u) + bit;
+                if (OS_HWOS_GET_CNTX_STAT(ctx_id) != OS_HWOS_CNTX_STAT_WAIT) {
+                    wait_tbl[ix] &= ~DEF_BIT(bit);
+                    rdy           = DEF_YES;
+                    nbr_rdy++;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (nbr_rdy != 0u) {                                        /* Remove the copies left in the queue.                 */
+        resp = 0x0001u;
+        while (resp == 0x0001u) {
+            OS_HWOS_SET_R4(p_q->QID);
+            OS_HWOS_SET_R5(0u);                                 /* Poll.                                                */
+            OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_RCV_MBX);
+
+            OS_HWOS_CMD_WAIT(resp);
+        }
+        resp = 0x0001u;
+    }
+
+    return (resp);
+}
+#endif /* OS_CFG_Q_EN == DEF_ENABLED */
@@ -143,6 +143,9 @@ void  OSSemCreate (OS_SEM      *p_sem,
 
     p_sem->SemID = sem_id;
     p_sem->Mutex = DEF_NO;
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatClr(&p_sem->Stat);
+#endif
     OSSemPtrTbl[i] = p_sem;
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -152,6 +155,7 @@ void  OSSemCreate (OS_SEM      *p_sem,
     RIN32_HWOS->SEM_TBL[sem_id] = DEF_BIT_18 | DEF_BIT_11 | (31 << 6);
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(sem_id | DEF_BIT_16);                        /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_R5(cnt);                                        /* Initial Count.                                       */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CRE_SEM);
@@ -237,6 +241,10 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
                        OS_ERR   *p_err)
 {
     CPU_INT32U sem_cnt;
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    CPU_TS       ts_start;
+    CPU_BOOLEAN  blocked;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -284,11 +292,19 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
 
     if (opt & OS_OPT_PEND_NON_BLOCKING) {
         timeout = 0u;
+    } else if (OSSchedLockNestingCtr > 0u) {
+        timeout = 0u;                                           /* Can't block while the scheduler is locked.           */
+    } else {
+        OS_SchedFlush();                                        /* Release a deferred switch before blocking.           */
     }
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    ts_start = CPU_TS_Get32();
+#endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_sem->SemID);                               /* HWOS Semaphore ID.                                   */
     OS_HWOS_SET_R5(timeout);                                    /* Timeout.                                             */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_WAI_SEM);
@@ -296,9 +312,16 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     OS_HWOS_CMD_PROC();
 
     sem_cnt = OS_HWOS_GET_SEM_CNT(p_sem->SemID);
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    blocked = OS_ObjStatPend(&p_sem->Stat);                     /* Count the pend before the task is switched out.      */
+#endif
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+    OS_ObjStatPendEnd(&p_sem->Stat, blocked, ts_start, OSTaskRet[OSCtxIDCur].r0 & OS_HWOS_RESP_MASK);
+#endif
+
     switch(OSTaskRet[OSCtxIDCur].r0) {
         case 0x0001:                                            /* Success.                                             */
         case 0x0003:                                            /* Success.                                             */
@@ -306,7 +329,11 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
              break;
 
         case 0x0004:                                            /* Would block.                                         */
-            *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {
+                *p_err = OS_ERR_PEND_WOULD_BLOCK;
+             } else {
+                *p_err = OS_ERR_SCHED_LOCKED;                   /* Polled since the scheduler is locked.                */
+             }
              break;
 
         case 0xFF86:                                            /* Timeout.                                             */
@@ -348,15 +375,12 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
 *
 *                        OS_OPT_POST_1         POST and ready only the highest priority task waiting on semaphore
 *                                              (if tasks are waiting).
-*                        OS_OPT_POST_ALL*      POST to ALL tasks that are waiting on the semaphore
+*                        OS_OPT_POST_ALL       POST to ALL tasks that are waiting on the semaphore
 *
-*                        OS_OPT_POST_NO_SCHED+ Do not call the scheduler
+*                        OS_OPT_POST_NO_SCHED  Do not call the scheduler
 *
 *                        Note(s): 1) OS_OPT_POST_NO_SCHED can be added with one of the other options.
 *
-*                        * Not supported by the HWOS, option will return an error.
-*                        + Not supported by the HWOS, option silently ignored.
-*
 *              p_err    is a pointer to a variable that will contain an error code returned by this function.
 *
 *                       OS_ERR_NONE          The call was successful and the semaphore was signaled.
@@ -365,6 +389,14 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
 *                       OS_ERR_SEM_OVF       If the post would cause the semaphore count to overflow.
 *
 * Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : 1) With OS_OPT_POST_ALL, every waiting task is readied while HWOS dispatching is disabled so
+*                 that at most one context switch is requested, once all the tasks are ready.  The
+*                 semaphore count is left unchanged when at least one task was readied.
+*
+*              2) With OS_OPT_POST_NO_SCHED, the context switch is held until OSSched() is called, the calling
+*                 task blocks, or it calls the kernel for anything else than another post with that option.
+*                 The option is ignored when posting from an ISR.
 *********************************************************************************************************
 */
 
@@ -399,11 +431,6 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
             *p_err =  OS_ERR_OPT_INVALID;
              return (0u);
     }
-
-    if ((opt & OS_OPT_POST_ALL) != 0u) {
-       *p_err = OS_ERR_HWOS_UNSUPPORTED;
-        return (0u);
-    }
 #endif
 
 #if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
@@ -415,14 +442,31 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 
 
     CPU_CRITICAL_ENTER();
+    OS_PRIO_SCHED_ENTER();                                      /* Order the readied tasks before dispatching them.     */
+    OS_OBJ_STAT_POST(p_sem);
+
+    if ((opt & OS_OPT_POST_NO_SCHED) != 0u) {
+        OS_SchedDefer();                                        /* Hold the switch for the posting sequence.            */
+    }
+
+    if ((opt & OS_OPT_POST_ALL) != 0u) {
+        OS_DispatchDis();                                       /* Ready all the waiters before switching.              */
+
+        ret_val = OS_SemPostAll(p_sem);
 
+        sem_cnt = OS_HWOS_GET_SEM_CNT(p_sem->SemID);
+        OS_DispatchEn();
+    } else {
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
-    OS_HWOS_SET_R4(p_sem->SemID);                               /* HWOS Semaphore ID.                                   */
-    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SIG_SEM);
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_R4(p_sem->SemID);                           /* HWOS Semaphore ID.                                   */
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SIG_SEM);
 
-    OS_HWOS_CMD_PROC_ISR(ret_val);
+        OS_HWOS_CMD_PROC_ISR(ret_val);
 
-    sem_cnt = OS_HWOS_GET_SEM_CNT(p_sem->SemID);
+        sem_cnt = OS_HWOS_GET_SEM_CNT(p_sem->SemID);
+    }
+    OS_PRIO_SCHED_EXIT(ret_val);
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
@@ -454,6 +498,86 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 #endif /* OS_CFG_SEM_EN == DEF_ENABLED */
 
 
+/*
+*********************************************************************************************************
+*                                    POST TO A SEMAPHORE ASYNCHRONOUSLY
+*
+* Description: This function signals a semaphore without waiting for the HWOS to complete the post.  The caller
+*              keeps running while the HWOS processes the command.
+*
+* Arguments  : p_sem    Pointer to the semaphore
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                       OS_ERR_NONE          The post was issued.
+*                       OS_ERR_OBJ_PTR_NULL  If 'p_sem' is a NULL pointer.
+*                       OS_ERR_OBJ_TYPE      If 'p_sem' is not pointing at a semaphore.
+*                       OS_ERR_POST_ISR      If you called this function from an ISR.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The result of the post is collected by the next HWOS command, see OS_PostAsyncCollect().  An
+*                 overflow of the semaphore count, or the deletion of the semaphore before the post was
+*                 processed, is reported by the next call to OSPostAsyncCollect().
+*
+*              2) The context switch is held while the HWOS processes the post, and only until the next call to
+*                 the kernel made by the calling task, which also collects the result.  OSSched(),
+*                 OSPostAsyncCollect() or blocking release it as well.
+*********************************************************************************************************
+*/
+
+#if ((OS_CFG_SEM_EN == DEF_ENABLED) && (OS_CFG_POST_ASYNC_EN == DEF_ENABLED))
+void  OSSemPostAsync (OS_SEM  *p_sem,
+                      OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_sem == DEF_NULL) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure the semaphore was created                  */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+
+    CPU_CRITICAL_ENTER();
+    OS_SchedDefer();                                            /* Hold the switch, see Note #2.                        */
+    OS_OBJ_STAT_POST(p_sem);
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(p_sem->SemID);                               /* HWOS Semaphore ID.                                   */
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SIG_SEM);
+
+    OSPostAsyncCtxID = OSCtxIDCur;                              /* Don't wait for the result, see Note #1.              */
+    OSPostAsyncCmd   = OS_HWOS_TSFNC_SIG_SEM;
+    OSPostAsyncPend  = DEF_YES;
+    CPU_CRITICAL_EXIT();
+    OS_SCHED_DEFER_CHK();                                       /* Release the switch on the next call, see Note #2.    */
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                                  DELETE A SEMAPHORE
@@ -530,6 +654,7 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
 #endif
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_sem->SemID);
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_DEL_SEM);
 
@@ -558,3 +683,270 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
     return (0u);
 }
 #endif /* OS_CFG_SEM_DEL_EN == DEF_ENABLED */
+
+
+/*
+*********************************************************************************************************
+*                                      SET A SEMAPHORE EVENT BATCH
+*
+* Description: Initialize a batch that counts the events of an ISR and posts a semaphore once every 'batch'
+*              events, so that the consumer is woken up once per batch instead of once per event.
+*
+* Arguments  : p_batch       Pointer to the batch.
+*
+*              p_sem         Pointer to the semaphore posted when the batch is complete.
+*
+*              batch         Number of events per wake up.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this
+*                            function.
+*
+*                            OS_ERR_NONE                  The call was successful.
+*                            OS_ERR_OBJ_PTR_NULL          p_batch or p_sem is NULL.
+*                            OS_ERR_OPT_INVALID           'batch' is 0.
+*
+* Returns    : none
+*
+* Note(s)    : 1) The events are counted by OSSemBatchPost(), called from the CPU ISR of the peripheral, so
+*                 each event still costs a CPU interrupt.  Only the wake ups of the consumer are batched.  The
+*                 semaphore MUST NOT be posted by a HW ISR, which would wake up the consumer on each event.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+void  OSSemBatchSet (OS_SEM_BATCH  *p_batch,
+                     OS_SEM        *p_sem,
+                     OS_SEM_CTR     batch,
+                     OS_ERR        *p_err)
+{
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if ((p_batch == DEF_NULL) || (p_sem == DEF_NULL)) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+
+    if (batch == 0u) {                                          /* Validate batch size.                                 */
+       *p_err = OS_ERR_OPT_INVALID;
+        return;
+    }
+#endif
+
+    p_batch->SemPtr = p_sem;
+    p_batch->Batch  = batch;
+    p_batch->Ctr    = 0u;
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     COUNT AN EVENT OF A BATCH
+*
+* Description: Count one event and post the semaphore of the batch when the batch becomes complete.  This
+*              function is meant to be called from the ISR of the peripheral.
+*
+* Arguments  : p_batch       Pointer to the batch.
+*
+* Returns    : DEF_YES, if the semaphore was posted.
+*              DEF_NO,  otherwise.
+*
+* Note(s)    : 1) The semaphore is posted once, when the count reaches the batch size.  The events counted
+*                 after that are added to the batch until the consumer takes it.
+*
+*              2) The count saturates at the largest OS_SEM_CTR value, the batch size and the latency bound
+*                 must be chosen so that the consumer takes the batch before.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+CPU_BOOLEAN  OSSemBatchPost (OS_SEM_BATCH  *p_batch)
+{
+    CPU_INT32U  ctr;
+    OS_ERR      os_err;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    ctr = p_batch->Ctr;
+    if (ctr < DEF_GET_U_MAX_VAL(p_batch->Ctr)) {                /* See Note #2.                                         */
+        ctr++;
+        p_batch->Ctr = (OS_SEM_CTR)ctr;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (ctr != p_batch->Batch) {                                /* Batch not complete, or already signaled.             */
+        return (DEF_NO);
+    }
+
+    (void)OSSemPost(p_batch->SemPtr,
+                    OS_OPT_POST_1,
+                   &os_err);
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          PEND ON AN EVENT BATCH
+*
+* Description: Wait until a batch has counted its number of events or until 'timeout' expires, whichever
+*              comes first, then consume all the events counted so far.
+*
+* Arguments  : p_batch       Pointer to the batch, initialized with OSSemBatchSet().
+*
+*              timeout       Maximum time to wait, in ticks, from the call.  If 0, wait for a full batch.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this
+*                            function.
+*
+*                            OS_ERR_NONE                  At least one event was consumed.
+*                            OS_ERR_OBJ_PTR_NULL          p_batch is NULL.
+*                            OS_ERR_TIMEOUT               No event occurred before the timeout.
+*                            Other                        Other OS_ERR_xxx returned by OSSemPend().
+*
+* Returns    : The number of events consumed, 0 upon error.
+*
+* Note(s)    : 1) The task pends once on the semaphore of the batch, which is only posted when the batch is
+*                 complete.  The timeout of the pend bounds the latency of a partial batch.
+*
+*              2) A batch completed just after the timeout leaves a post in the semaphore with no batch
+*                 behind it.  The next call then wakes up early, sees an incomplete batch and pends again.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+OS_SEM_CTR  OSSemPendBatch (OS_SEM_BATCH  *p_batch,
+                            OS_TICK        timeout,
+                            OS_ERR        *p_err)
+{
+    OS_SEM_CTR  nbr;
+    OS_TICK     ts_start;
+    OS_TICK     elapsed;
+    OS_TICK     dly;
+    OS_ERR      os_err;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(0u);
+    }
+
+    if (p_batch == DEF_NULL) {
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+#endif
+
+    dly      = 0u;
+    ts_start = OSTimeGet(&os_err);
+
+    while (DEF_ON) {
+        if (timeout != 0u) {
+            elapsed = OSTimeGet(&os_err) - ts_start;
+            if (elapsed >= timeout) {                           /* Latency bound reached.                               */
+               *p_err = OS_ERR_TIMEOUT;
+                break;
+            }
+            dly = timeout - elapsed;
+        }
+
+        (void)OSSemPend(p_batch->SemPtr,                        /* Wait for a complete batch.                           */
+                        dly,
+                        OS_OPT_PEND_BLOCKING,
+                        DEF_NULL,
+                        p_err);
+        if (*p_err == OS_ERR_TIMEOUT) {
+            break;
+        }
+        if (*p_err != OS_ERR_NONE) {
+            return (0u);
+        }
+
+        CPU_CRITICAL_ENTER();
+        nbr = p_batch->Ctr;
+        if (nbr >= p_batch->Batch) {                            /* Take the batch and the events counted since.         */
+            p_batch->Ctr = 0u;
+            CPU_CRITICAL_EXIT();
+            return (nbr);
+        }
+        CPU_CRITICAL_EXIT();                                    /* Stale post, see Note #2.                             */
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* Timeout, take the partial batch.                     */
+    nbr          = p_batch->Ctr;
+    p_batch->Ctr = 0u;
+    CPU_CRITICAL_EXIT();
+
+    if (nbr != 0u) {
+       *p_err = OS_ERR_NONE;
+    }
+
+    return (nbr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    BROADCAST POST TO A SEMAPHORE
+*
+* Description: This function readies every task waiting on a semaphore.  The HWOS only releases one waiting
+*              task per signal, so the semaphore is signaled until a signal is absorbed by the count instead
+*              of releasing a task.  That last signal is then taken back if any task was readied.
+*
+* Arguments  : p_sem    Pointer to the semaphore
+*
+* Returns    : The HWOS response code of the last signal.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts and HWOS dispatching disabled.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+CPU_INT32U  OS_SemPostAll (OS_SEM  *p_sem)
+{
+    CPU_INT32U  nbr_rdy;
+    CPU_INT32U  resp;
+    CPU_INT32U  resp_wait;
+
+
+    resp = 0x0001u;
+    for (nbr_rdy = 0u; nbr_rdy < OS_HWOS_CNTX_CNT; nbr_rdy++) { /* A context can only wait once.                       */
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_R4(p_sem->SemID);                           /* HWOS Semaphore ID.                                   */
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SIG_SEM);
+
+        OS_HWOS_CMD_WAIT(resp);
+
+        if (resp != 0x0001u) {                                  /* Overflow or invalid semaphore.                       */
+            break;
+        }
+
+        if (OS_HWOS_GET_SEM_CNT(p_sem->SemID) != 0u) {          /* No task left waiting, the count was incremented.     */
+            if (nbr_rdy != 0u) {                                /* Take it back if a task was readied.                  */
+                OS_HWOS_SET_R4(p_sem->SemID);
+                OS_HWOS_SET_R5(0u);                             /* Poll.                                                */
+                OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_WAI_SEM);
+
+                OS_HWOS_CMD_WAIT(resp_wait);
+                (void)&resp_wait;
+            }
+            break;
+        }
+    }
+
+    return (resp);
+}
+#endif /* OS_CFG_SEM_EN == DEF_ENABLED */
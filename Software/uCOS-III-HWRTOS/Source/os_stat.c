@@ -0,0 +1,323 @@
+/*
+*********************************************************************************************************
+*                                           uC/OS-III HW-RTOS
+*
+*                         (c) Copyright 2004-2014; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/OS-III-HWOS is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: www.micrium.com
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                          OBJECT STATISTICS
+*
+* Filename      : os_stat.c
+*
+* Note(s)       : (1) Every semaphore, mutex, queue and event flag group keeps an OS_OBJ_STAT.  The posts are
+*                     counted by OS_OBJ_STAT_POST(), the pends by OS_ObjStatPend() and OS_ObjStatPendEnd().
+*
+*                 (2) The HWOS does not tell whether a pend blocked.  A pend is counted as blocked when the
+*                     HWOS requested a switch away from the pending task, which it only does to block it.
+*
+*                 (3) The block time runs from the pend command until the task resumes.  It thus includes the
+*                     time the task was ready but preempted after being readied.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+
+#if (OS_CFG_STAT_OBJ_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*/
+
+static  void  OS_ObjStatVisit (void              *p_obj,
+                               OS_OBJ_TYPE        type,
+                               OS_OBJ_STAT       *p_stat,
+                               OS_OBJ_STAT_FNCT   p_fnct,
+                               void              *p_arg);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                     ITERATE THE OBJECT STATISTICS
+*
+* Description: This function calls 'p_fnct' for every semaphore, mutex, queue and event flag group that exists,
+*              with a snapshot of its statistics.
+*
+* Arguments  : p_fnct    is the function to call.  It receives:
+*
+*                            p_obj     a pointer to the object (OS_SEM, OS_MUTEX, OS_Q or OS_FLAG_GRP)
+*                            type      the type of the object, OS_OBJ_TYPE_SEM, _MUTEX, _Q or _FLAG
+*                            p_stat    a pointer to the snapshot of the object statistics
+*                            p_arg     the argument passed to this function
+*
+*              p_arg     is an argument passed to 'p_fnct'.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                 The statistics were iterated
+*                            OS_ERR_PTR_INVALID          If 'p_fnct' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) Each snapshot is taken with interrupts disabled, so the counters of an object are consistent.
+*                 'p_fnct' is called with interrupts enabled and can be slow, e.g. to print the counters.
+*
+*              2) An object deleted while the function runs may still be reported once.
+*********************************************************************************************************
+*/
+
+void  OSStatObjIterate (OS_OBJ_STAT_FNCT   p_fnct,
+                        void              *p_arg,
+                        OS_ERR            *p_err)
+{
+    CPU_INT32U  i;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_fnct == DEF_NULL) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    for (i = 0u; i < OS_HWOS_SEM_CNT; i++) {                    /* Semaphores and mutexes share the HWOS semaphores.    */
+        if (OSSemPtrTbl[i] != DEF_NULL) {
+            OS_ObjStatVisit((void *)OSSemPtrTbl[i],
+                            (OSSemPtrTbl[i]->Mutex == DEF_YES) ? OS_OBJ_TYPE_MUTEX : OS_OBJ_TYPE_SEM,
+                            &OSSemPtrTbl[i]->Stat,
+                             p_fnct,
+                             p_arg);
+        }
+    }
+
+    for (i = 0u; i < OS_HWOS_Q_CNT; i++) {
+        if (OSQPtrTbl[i] != DEF_NULL) {
+            OS_ObjStatVisit((void *)OSQPtrTbl[i], OS_OBJ_TYPE_Q, &OSQPtrTbl[i]->Stat, p_fnct, p_arg);
+        }
+    }
+
+    for (i = 0u; i < OS_HWOS_FLAG_CNT; i++) {
+        if (OSGrpPtrTbl[i] != DEF_NULL) {
+            OS_ObjStatVisit((void *)OSGrpPtrTbl[i], OS_OBJ_TYPE_FLAG, &OSGrpPtrTbl[i]->Stat, p_fnct, p_arg);
+        }
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          INTERNAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                      CLEAR THE OBJECT STATISTICS
+*
+* Description: This function resets the statistics of an object being created.
+*
+* Arguments  : p_stat    is a pointer to the statistics.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*********************************************************************************************************
+*/
+
+void  OS_ObjStatClr (OS_OBJ_STAT  *p_stat)
+{
+    p_stat->PostCtr        = 0u;
+    p_stat->PendCtr        = 0u;
+    p_stat->PendBlockCtr   = 0u;
+    p_stat->PendTimeoutCtr = 0u;
+    p_stat->WaitNbr        = 0u;
+    p_stat->WaitNbrMax     = 0u;
+    p_stat->BlockTimeTot   = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            COUNT A PEND
+*
+* Description: This function counts a pend once its HWOS command has been processed and, if the pending task
+*              blocks, counts it as a waiter of the object.
+*
+* Arguments  : p_stat    is a pointer to the statistics of the object.
+*
+* Returns    : DEF_YES   if the pending task blocks.
+*              DEF_NO    otherwise.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled, right after OS_HWOS_CMD_PROC().  The
+*                 switch requested by the HWOS, if any, is still pending at that time.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_ObjStatPend (OS_OBJ_STAT  *p_stat)
+{
+    p_stat->PendCtr++;
+
+    if (OSHWOSPendCtxSw == OSCtxIDCur) {                        /* Not switched away: the pend did not block.           */
+        return (DEF_NO);
+    }
+
+    p_stat->PendBlockCtr++;
+    p_stat->WaitNbr++;
+    if (p_stat->WaitNbr > p_stat->WaitNbrMax) {
+        p_stat->WaitNbrMax = p_stat->WaitNbr;
+    }
+
+    return (DEF_YES);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         COMPLETE A COUNTED PEND
+*
+* Description: This function accounts for the outcome of a pend once the pending task runs again.
+*
+* Arguments  : p_stat    is a pointer to the statistics of the object.
+*
+*              blocked   is the value returned by OS_ObjStatPend().
+*
+*              ts_start  is the timestamp taken before the pend command was issued.
+*
+*              resp      is the HWOS response to the pend.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) The waiter count is only decremented while positive, since the object could have been deleted
+*                 and created again while the task was blocked.
+*********************************************************************************************************
+*/
+
+void  OS_ObjStatPendEnd (OS_OBJ_STAT  *p_stat,
+                         CPU_BOOLEAN   blocked,
+                         CPU_TS        ts_start,
+                         CPU_INT32U    resp)
+{
+    CPU_TS  ts_dly;
+    CPU_SR_ALLOC();
+
+
+    if (blocked == DEF_NO) {
+        if (resp == 0xFF86u) {                                  /* Timeout.                                             */
+            CPU_CRITICAL_ENTER();
+            p_stat->PendTimeoutCtr++;
+            CPU_CRITICAL_EXIT();
+        }
+        return;
+    }
+
+    ts_dly = CPU_TS_Get32() - ts_start;
+
+    CPU_CRITICAL_ENTER();
+    if (p_stat->WaitNbr > 0u) {                                 /* See Note #2.                                         */
+        p_stat->WaitNbr--;
+    }
+    p_stat->BlockTimeTot += ts_dly;
+    if (resp == 0xFF86u) {                                      /* Timeout.                                             */
+        p_stat->PendTimeoutCtr++;
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                        REPORT ONE OBJECT
+*
+* Description: This function takes a snapshot of the statistics of an object and passes it to the iterator
+*              function.
+*
+* Arguments  : p_obj     is a pointer to the object.
+*
+*              type      is the type of the object.
+*
+*              p_stat    is a pointer to the statistics of the object.
+*
+*              p_fnct    is the iterator function.
+*
+*              p_arg     is the argument of the iterator function.
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+static  void  OS_ObjStatVisit (void              *p_obj,
+                               OS_OBJ_TYPE        type,
+                               OS_OBJ_STAT       *p_stat,
+                               OS_OBJ_STAT_FNCT   p_fnct,
+                               void              *p_arg)
+{
+    OS_OBJ_STAT  stat;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    stat = *p_stat;
+    CPU_CRITICAL_EXIT();
+
+    p_fnct(p_obj, type, &stat, p_arg);
+}
+#endif
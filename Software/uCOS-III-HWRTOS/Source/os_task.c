@@ -94,7 +94,7 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         CPU_SW_EXCEPTION(;);
     }
 
-    if (prio_new >= OS_HWOS_MAX_PRIO) {
+    if (prio_new >= (OS_CFG_PRIO_MAX - 1u)) {
        *p_err = OS_ERR_PRIO_INVALID;
         return;
     }
@@ -108,9 +108,16 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 
     CPU_CRITICAL_ENTER();
 
+    OSTaskTCBPtrTbl[ctx_id]->Prio = prio_new;
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    OS_PrioRdyClr(ctx_id);                                      /* Order the task within its new band.                  */
+#endif
+
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(ctx_id);
-    OS_HWOS_SET_R5(prio_new);
+    OS_HWOS_SET_R5(OS_PRIO_TO_HW(prio_new));
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CHG_PRI);
 
     OS_HWOS_CMD_PROC();
@@ -161,7 +168,8 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 }
 *
 *              prio           Task's priority.  A unique priority MUST be assigned to each task and the
-*                             lower the number, the higher the priority.
+*                             lower the number, the higher the priority.  Priorities range from 0 to
+*                             OS_CFG_PRIO_MAX-2, they are folded onto the HWOS priorities by OS_PRIO_TO_HW().
 *
 *              p_stk_base     Pointer to the base address of the stack (i.e. low address).
 *
@@ -175,7 +183,9 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *
 *              q_size         Maximum number of messages that can be sent to the task
 *
-*              time_quanta    Argument has no effect. Left for compatibility with uC/OS-III.
+*              time_quanta    Amount of time (in ticks) for the time slice when round-robin between tasks of
+*                             the same priority is enabled.  Specify 0 to use the default time slice.  Ignored
+*                             when OS_CFG_SCHED_ROUND_ROBIN_EN is disabled.
 *
 *              p_ext          Argument has no effect. Left for compatibility with uC/OS-III.
 *
@@ -271,7 +281,7 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
         return;
     }
 
-    if ((prio >= OS_HWOS_MAX_PRIO) && (p_tcb != &OSIdleTaskTCB) ) {
+    if ((prio >= (OS_CFG_PRIO_MAX - 1u)) && (p_tcb != &OSIdleTaskTCB) ) {
        *p_err = OS_ERR_PRIO_INVALID;
         return;
     }
@@ -292,12 +302,36 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
         return;
     }
 
-    p_tcb->CtxID = ctx_id;
+    p_tcb->CtxID        = ctx_id;
+    p_tcb->Prio         = prio;
+    p_tcb->SuspendCtr   = 0u;
+    p_tcb->SuspendState = OS_TASK_SUSPEND_NONE;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    p_tcb->MutexCtr     = 0u;
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     p_tcb->NamePtr = p_name;
 #endif
 
+#if (OS_CFG_POST_ASYNC_EN == DEF_ENABLED)
+    p_tcb->PostAsyncErr = OS_ERR_NONE;
+#endif
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+    p_tcb->TimeQuanta = time_quanta;                            /* Save the time slice (0 means ...                     */
+    if (time_quanta == 0u) {                                    /* ... use the default time slice).                     */
+        p_tcb->TimeQuantaCtr = OSSchedRoundRobinDfltTimeQuanta;
+    } else {
+        p_tcb->TimeQuantaCtr = time_quanta;
+    }
+#endif
+
+    OSTaskTCBPtrTbl[ctx_id] = p_tcb;
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    OS_PrioRdyClr(ctx_id);                                      /* Order the task within its band once it is ready.     */
+#endif
+
     if ((opt & OS_OPT_TASK_STK_CHK) != 0u) {
         p_sp = p_stk_base;
         for (i = 0u; i < stk_size; i++) {                       /* Stack grows from HIGH to LOW memory                  */
@@ -306,22 +340,23 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
         }
     }
 
-    OSTaskStkPtrTbl[i] = OS_CPU_TaskInit(p_task, p_arg, p_stk_base, stk_size);
+    OSTaskStkPtrTbl[ctx_id] = OS_CPU_TaskInit(p_task, p_arg, p_stk_base, stk_size);
 
 
     if (OSRunning == DEF_NO) {
         RIN32_HWOS->CNTX[ctx_id].CNTX_TYPE = 0x03;
         RIN32_HWOS->CNTX[ctx_id].CNTX_STAT = 0x03;
         RIN32_HWOS->CNTX[ctx_id].INIT_ADD = (CPU_INT32U)p_task;
-        RIN32_HWOS->CNTX[ctx_id].PRTY = (prio) | (prio << 8u);
-        RIN32_HWOS->CNTX[ctx_id].INIT_R14 = (CPU_INT32U)OSTaskStkPtrTbl[i];
+        RIN32_HWOS->CNTX[ctx_id].PRTY = OS_PRIO_TO_HW(prio) | (OS_PRIO_TO_HW(prio) << 8u);
+        RIN32_HWOS->CNTX[ctx_id].INIT_R14 = (CPU_INT32U)OSTaskStkPtrTbl[ctx_id];
     }
 
    *p_err = OS_ERR_NONE;
 
     if (OSRunning == DEF_YES) {
+        OS_HWOS_CMD_SYNC();
         OS_HWOS_SET_R4(ctx_id);
-        OS_HWOS_SET_R5(prio);
+        OS_HWOS_SET_R5(OS_PRIO_TO_HW(prio));
         OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_CHG_PRI);
 
         OS_HWOS_CMD_PROC();
@@ -352,6 +387,142 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      CREATE A DYNAMIC TASK
+*
+* Description: This function creates a task whose TCB and stack are allocated by uC/OS-III HW-RTOS.  The
+*              TCB comes from a pool of TCBs and the stack from the pool of the smallest stack size class
+*              that fits 'stk_size'.  Both are returned to their pool when the task is deleted with
+*              OSTaskDelDyn().
+*
+* Arguments  : p_name         Pointer to an ASCII string to provide a name to the task.
+*
+*              p_task         Pointer to the task's code
+*
+*              p_arg          Pointer to an optional data area passed to the task when it first executes.
+*
+*              prio           Task's priority.  See OSTaskCreate().
+*
+*              stk_size       Minimum size of the stack in number of elements.  The stack is rounded up to
+*                             the next stack size class.
+*
+*              q_size         Maximum number of messages that can be sent to the task
+*
+*              time_quanta    Amount of time (in ticks) for the time slice.  See OSTaskCreate().
+*
+*              p_ext          Argument has no effect. Left for compatibility with uC/OS-III.
+*
+*              opt            contains additional information (or options) about the behavior of the task.
+*                             See OSTaskCreate().
+*
+*              p_err          is a pointer to an error code that will be set during this call.  The value pointer
+*                             to by 'p_err' can be:
+*
+*                             OS_ERR_NONE                if the function was successful.
+*                             OS_ERR_MEM_NO_FREE_BLKS    if there is no memory left for the stack.
+*                             OS_ERR_STK_SIZE_INVALID    if 'stk_size' is larger than the largest stack size class.
+*                             OS_ERR_TASK_CREATE_ISR     if you tried to create a task from an ISR.
+*                             OS_ERR_TASK_NO_MORE_TCB    if there is no TCB left.
+*                             Other                      Other OS_ERR_xxx returned by OSTaskCreate().
+*
+* Returns    : A pointer to the TCB of the task, DEF_NULL if the task could not be created.
+*
+* Note(s)    : 1) The memory of the tasks that deleted themselves is reclaimed first, see OS_TaskDynReap().
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+OS_TCB  *OSTaskCreateDyn (CPU_CHAR      *p_name,
+                          OS_TASK_PTR    p_task,
+                          void          *p_arg,
+                          OS_PRIO        prio,
+                          CPU_STK_SIZE   stk_size,
+                          OS_MSG_QTY     q_size,
+                          OS_TICK        time_quanta,
+                          void          *p_ext,
+                          OS_OPT         opt,
+                          OS_ERR        *p_err)
+{
+    OS_TCB        *p_tcb;
+    CPU_STK       *p_stk;
+    CPU_STK_SIZE   stk_size_class;
+    CPU_INT08U     stk_class;
+    LIB_ERR        lib_err;
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TASK_CREATE_ISR;
+        return (DEF_NULL);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+#endif
+
+    stk_size_class = OS_CFG_TASK_DYN_STK_SIZE_MIN;              /* Find the smallest stack size class that fits.        */
+    for (stk_class = 0u; stk_class < OS_CFG_TASK_DYN_STK_CLASS_NBR; stk_class++) {
+        if (stk_size <= stk_size_class) {
+            break;
+        }
+        stk_size_class *= 2u;
+    }
+
+    if (stk_class == OS_CFG_TASK_DYN_STK_CLASS_NBR) {
+       *p_err = OS_ERR_STK_SIZE_INVALID;
+        return (DEF_NULL);
+    }
+
+    OS_TaskDynReap();                                           /* Reclaim the memory of the deleted tasks.             */
+
+    p_tcb = (OS_TCB *)Mem_DynPoolBlkGet(&OSTaskDynTCBPool, &lib_err);
+    if (lib_err != LIB_MEM_ERR_NONE) {
+       *p_err = OS_ERR_TASK_NO_MORE_TCB;
+        return (DEF_NULL);
+    }
+
+    p_stk = (CPU_STK *)Mem_DynPoolBlkGet(&OSTaskDynStkPool[stk_class], &lib_err);
+    if (lib_err != LIB_MEM_ERR_NONE) {
+        Mem_DynPoolBlkFree(&OSTaskDynTCBPool, p_tcb, &lib_err);
+       *p_err = OS_ERR_MEM_NO_FREE_BLKS;
+        return (DEF_NULL);
+    }
+
+    p_tcb->DynStkBasePtr = p_stk;                               /* Set before the task can run and delete itself.       */
+    p_tcb->DynStkClass   = stk_class;
+    p_tcb->DynNextPtr    = DEF_NULL;
+    p_tcb->DynType       = OS_OBJ_TYPE_TASK_DYN;
+
+    OSTaskCreate(p_tcb,
+                 p_name,
+                 p_task,
+                 p_arg,
+                 prio,
+                 p_stk,
+                 stk_size_class / 10u,
+                 stk_size_class,
+                 q_size,
+                 time_quanta,
+                 p_ext,
+                 opt,
+                 p_err);
+
+    if (*p_err != OS_ERR_NONE) {
+        p_tcb->DynType = OS_OBJ_TYPE_NONE;
+        Mem_DynPoolBlkFree(&OSTaskDynStkPool[stk_class], p_stk, &lib_err);
+        Mem_DynPoolBlkFree(&OSTaskDynTCBPool,            p_tcb, &lib_err);
+        return (DEF_NULL);
+    }
+
+    return (p_tcb);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                            DELETE A TASK
@@ -369,6 +540,8 @@ void          OSTaskCreate              (OS_TCB                *p_tcb,
 *                         OS_ERR_TASK_DEL_IDLE     if you attempted to delete uC/OS-III's idle task
 *                         OS_ERR_TASK_DEL_INVALID  if you attempted to delete uC/OS-III's ISR handler task
 *                         OS_ERR_TASK_DEL_ISR      if you tried to delete a task from an ISR
+*                         OS_ERR_SCHED_LOCKED      if you tried to delete the calling task while the scheduler
+*                                                  is locked
 *
 * Returns    : none
 *********************************************************************************************************
@@ -379,6 +552,7 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 {
     CPU_INT32U     ctx_id;
     CPU_BOOLEAN    self;
+    CPU_BOOLEAN    stopped;
     CPU_SR_ALLOC();
 
 
@@ -400,6 +574,14 @@ void  OSTaskDel (OS_TCB  *p_tcb,
         return;
     }
 
+    if ((p_tcb == DEF_NULL) || (p_tcb->CtxID == OSCtxIDCur)) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't exit when the scheduler is locked.             */
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+        OS_SchedFlush();                                        /* Release a deferred switch before exiting.            */
+    }
+
     CPU_CRITICAL_ENTER();
 
     if (p_tcb == DEF_NULL) {
@@ -414,14 +596,23 @@ void  OSTaskDel (OS_TCB  *p_tcb,
         }
     }
 
+    stopped = DEF_NO;
     switch (OS_HWOS_GET_CNTX_STAT(ctx_id)) {
         case OS_HWOS_CNTX_STAT_WAIT:
         case OS_HWOS_CNTS_STAT_RDY:
         case OS_HWOS_CNTX_STAT_RUN:
              break;
 
+        case OS_HWOS_CNTX_STAT_STOP:                            /* Stopped by OSTaskSuspend(), nothing left to stop.    */
+             if (OSTaskTCBPtrTbl[ctx_id]->SuspendState == OS_TASK_SUSPEND_STOP) {
+                 stopped = DEF_YES;
+                 break;
+             }
+            *p_err = OS_ERR_STATE_INVALID;                      /* Can't delete a stopped or deleted task.              */
+             CPU_CRITICAL_EXIT();
+             return;
+
         case OS_HWOS_CNTX_STAT_IDLE:
-        case OS_HWOS_CNTX_STAT_STOP:
             *p_err = OS_ERR_STATE_INVALID;                      /* Can't delete a stopped or deleted task.              */
              CPU_CRITICAL_EXIT();
              return;
@@ -434,12 +625,20 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
 
     OSTaskStkPtrTbl[ctx_id] = DEF_NULL;                         /* Clear the stack entry.                               */
+    OSTaskTCBPtrTbl[ctx_id] = DEF_NULL;
 
 #if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
     p_tcb->Type = OS_OBJ_TYPE_NONE;
 #endif
 
+    if (stopped == DEF_YES) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(ctx_id);
     if (self == DEF_YES) {
     	OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_EXT_TSK);
@@ -471,12 +670,117 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       DELETE A DYNAMIC TASK
+*
+* Description: This function deletes a task created by OSTaskCreateDyn() and returns its TCB and stack to
+*              their pool.  The calling task can delete itself by specifying a NULL pointer for 'p_tcb'.
+*
+* Arguments  : p_tcb      TCB of the tack to delete
+*
+*              p_err      Pointer to an error code returned by this function:
+*
+*                         OS_ERR_NONE              if the call is successful
+*                         OS_ERR_TASK_DEL_ISR      if you tried to delete a task from an ISR
+*                         OS_ERR_TASK_INVALID      if the task was not created by OSTaskCreateDyn() or was
+*                                                  already deleted
+*                         OS_ERR_SCHED_LOCKED      if you tried to delete the calling task while the scheduler
+*                                                  is locked
+*                         Other                    Other OS_ERR_xxx returned by OSTaskDel().
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task can't free the stack it runs on.  When a task deletes itself, its TCB is put on the
+*                 reaper list and its memory is reclaimed by the idle task or the next OSTaskCreateDyn().
+*                 The TCB is taken back off the list if OSTaskDel() fails.
+*
+*              2) 'p_tcb' is checked by OS_TaskDynIsLive() before it is used, so a stale or stray pointer is
+*                 rejected instead of being freed.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+void  OSTaskDelDyn (OS_TCB  *p_tcb,
+                    OS_ERR  *p_err)
+{
+    OS_TCB  **pp_tcb;
+    LIB_ERR   lib_err;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed from an ISR                              */
+       *p_err = OS_ERR_TASK_DEL_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+    if (p_tcb == DEF_NULL) {
+        p_tcb = OSTaskTCBPtrTbl[OSCtxIDCur];
+    }
+
+    if (OS_TaskDynIsLive(p_tcb) == DEF_NO) {                    /* TCB must be allocated by OSTaskCreateDyn().          */
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+
+    if (p_tcb->CtxID == OSCtxIDCur) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't exit when the scheduler is locked.             */
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+
+        CPU_CRITICAL_ENTER();                                   /* Let the reaper free the memory once we are gone.     */
+        p_tcb->DynNextPtr    = OSTaskDynReapListPtr;
+        OSTaskDynReapListPtr = p_tcb;
+        OSTaskDynReapCtr++;                                     /* Signal the idle task.                                */
+        p_tcb->DynType       = OS_OBJ_TYPE_NONE;                /* Can't be deleted again while on the list.            */
+        CPU_CRITICAL_EXIT();
+
+        OSTaskDel(p_tcb, p_err);                                /* Only returns on error.                               */
+
+        CPU_CRITICAL_ENTER();                                   /* Still alive, take the TCB back off the list.         */
+        pp_tcb = &OSTaskDynReapListPtr;
+        while (*pp_tcb != DEF_NULL) {
+            if (*pp_tcb == p_tcb) {
+               *pp_tcb = p_tcb->DynNextPtr;
+                OSTaskDynReapCtr--;
+                break;
+            }
+            pp_tcb = &(*pp_tcb)->DynNextPtr;
+        }
+        p_tcb->DynNextPtr = DEF_NULL;
+        p_tcb->DynType    = OS_OBJ_TYPE_TASK_DYN;
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+
+    OSTaskDel(p_tcb, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    p_tcb->DynType = OS_OBJ_TYPE_NONE;
+    Mem_DynPoolBlkFree(&OSTaskDynStkPool[p_tcb->DynStkClass], p_tcb->DynStkBasePtr, &lib_err);
+    Mem_DynPoolBlkFree(&OSTaskDynTCBPool,                     p_tcb,                &lib_err);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           SUSPEND A TASK
 *
 * Description: This function is called to suspend a task.  The task can be the calling task if 'p_tcb'
-*              is a NULL pointer or the pointer to the TCB of the calling task.
+*              is a NULL pointer or the pointer to the TCB of the calling task.  Calls can be nested, the
+*              task runs again once OSTaskResume() has been called as many times as OSTaskSuspend().
 *
 * Arguments  : p_tcb    Pointer to the TCB to suspend.
 *                       If p_tcb is a NULL pointer then, suspend the current task.
@@ -486,66 +790,164 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 *                       OS_ERR_NONE                      if the requested task is suspended
 *                       OS_ERR_SCHED_LOCKED              you can't suspend the current task is the scheduler is
 *                                                        locked
-*                       OS_ERR_TASK_SUSPEND_ISR          if you called this function from an ISR
+*                       OS_ERR_STATE_INVALID             if the task is deleted or not started
+*                       OS_ERR_TASK_SUSPEND_CTR_OVF      if the task was suspended too many times
+*                       OS_ERR_TASK_SUSPEND_ISR          if you passed a NULL pointer from an ISR
 *                       OS_ERR_TASK_SUSPEND_IDLE         if you attempted to suspend the idle task which is not
 *                                                        allowed.
-*                       OS_ERR_TASK_SUSPEND_INT_HANDLER  if you attempted to suspend the idle task which is not
-*                                                        allowed.
 *
-* Note(s)    : 1) You should use this function with great care.  If you suspend a task that is waiting
-*                 for an event (i.e. a message, a semaphore, a queue ...) you will prevent this task from
-*                 running when the event arrives.
+* Note(s)    : 1) A suspended task is stopped in the HWOS, or sleeps in OS_TaskSuspendWait(), until it is
+*                 resumed:
+*
+*                 (a) The calling task goes to sleep right away.
+*
+*                 (b) A ready task, or the task interrupted by the ISR calling this function, is stopped by
+*                     ter_tsk.  Its context is kept and OSTaskResume() restarts it where it was stopped.
+*
+*                 (c) A waiting task carries on waiting, its wait is not cancelled.  Once the event arrives
+*                     or the wait times out, it goes to sleep on its way out of the kernel, before it
+*                     returns to the application.
+*
+*                 (d) A task that holds a mutex, or the interrupted task while it locks the scheduler, is
+*                     not stopped: ter_tsk would release its mutexes, or keep the scheduler locked for good.
+*                     The suspension takes effect late, the task keeps running until its next call to the
+*                     kernel and only goes to sleep there.  For such a task, the suspension is only a hint.
+*
+*              2) This function can be called from an ISR to suspend another task.
 *********************************************************************************************************
 */
 
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
 void  OSTaskSuspend (OS_TCB  *p_tcb,
                      OS_ERR  *p_err)
 {
+    CPU_INT32U  stat;
+    CPU_INT32U  ret_val;
     CPU_SR_ALLOC();
 
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed from an ISR                              */
-       *p_err = OS_ERR_TASK_SUSPEND_ISR;
-        return;
-    }
-#endif
-
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
     if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
         CPU_SW_EXCEPTION(;);
     }
+#endif
+
+    if (p_tcb == DEF_NULL) {
+        if (OSIntNestingCtr > 0u) {                             /* No current task to suspend in an ISR.                */
+           *p_err = OS_ERR_TASK_SUSPEND_ISR;
+            return;
+        }
+        p_tcb = OSTaskTCBPtrTbl[OSCtxIDCur];
+    }
 
-    if ((p_tcb != DEF_NULL) && (p_tcb->CtxID != OSCtxIDCur)) {
-       *p_err = OS_ERR_HWOS_UNSUPPORTED;                        /* The HWOS can't suspend another task.                 */
+    if (p_tcb == &OSIdleTaskTCB) {                              /* Not allowed to suspend the idle task                 */
+       *p_err = OS_ERR_TASK_SUSPEND_IDLE;
         return;
     }
-#endif
+
+    if ((OSIntNestingCtr == 0u) && (p_tcb->CtxID == OSCtxIDCur)) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't suspend when the scheduler is locked.          */
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+    }
 
     CPU_CRITICAL_ENTER();
 
+    stat = OS_HWOS_GET_CNTX_STAT(p_tcb->CtxID);
+    switch (stat) {
+        case OS_HWOS_CNTX_STAT_WAIT:
+        case OS_HWOS_CNTS_STAT_RDY:
+        case OS_HWOS_CNTX_STAT_RUN:
+             break;
+
+        case OS_HWOS_CNTX_STAT_STOP:
+             if (p_tcb->SuspendState == OS_TASK_SUSPEND_STOP) { /* Stopped by an earlier call.                          */
+                 break;
+             }
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;                      /* Can't suspend a stopped or deleted task.             */
+             return;
+
+        case OS_HWOS_CNTX_STAT_IDLE:
+        default:
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_STATE_INVALID;                      /* Can't suspend a stopped or deleted task.             */
+             return;
+    }
+
+    if (p_tcb->SuspendCtr == (OS_NESTING_CTR)~0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_SUSPEND_CTR_OVF;
+        return;
+    }
+
+    p_tcb->SuspendCtr++;
+    if (p_tcb->SuspendState != OS_TASK_SUSPEND_NONE) {          /* Task is already suspended.                           */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((OSIntNestingCtr == 0u) && (p_tcb->CtxID == OSCtxIDCur)) {
+        p_tcb->SuspendState = OS_TASK_SUSPEND_PEND;             /* See Note #1a.                                        */
+        CPU_CRITICAL_EXIT();
+        OS_TaskSuspendWait();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if (stat == OS_HWOS_CNTX_STAT_WAIT) {
+        p_tcb->SuspendState = OS_TASK_SUSPEND_PEND;             /* See Note #1c.                                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if ((stat == OS_HWOS_CNTX_STAT_RUN) &&                      /* Interrupted task holds the scheduler, see Note #1d.  */
+        ((OSSchedLockNestingCtr > 0u) || (OSDispatchDisCtr > 0u) || (OSSchedDeferred != OS_SCHED_DEFER_NONE))) {
+        p_tcb->SuspendState = OS_TASK_SUSPEND_PEND;
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    if (p_tcb->MutexCtr > 0u) {
+        p_tcb->SuspendState = OS_TASK_SUSPEND_PEND;             /* See Note #1d.                                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
+
+    p_tcb->SuspendState = OS_TASK_SUSPEND_STOP;                 /* See Note #1b.                                        */
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
-    OS_HWOS_SET_R5(0xFFFFFFFF);
-    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SLP_TSK);
+    OS_HWOS_CMD_SYNC();
+    OS_HWOS_SET_R4(p_tcb->CtxID);                               /* Context id of the task to stop.                      */
+    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_TER_TSK);
 
-    OS_HWOS_CMD_PROC();
+    OS_HWOS_CMD_PROC_ISR(ret_val);
 
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
-    switch (OSTaskRet[OSCtxIDCur].r0) {
-        case 0xFF8D:                                            /* Wait release wup_tsk.                                */
-        case 0xFF90:                                            /* Wait release rel_wai.                                */
+    if (ret_val == 0u) {
+        ret_val = OSTaskRet[OSCtxIDCur].r0;
+    }
+
+    switch (ret_val) {
+        case 0x0001:                                            /* Success, or switched in an ISR.                      */
             *p_err = OS_ERR_NONE;
              break;
 
         case 0xFF80:                                            /* Invalid System Call.                                 */
-        case 0xFF86:                                            /* Time out.                                            */
         default:
              CPU_SW_EXCEPTION(;);
              break;
     }
 }
+#endif
 
 
 /*
@@ -559,50 +961,104 @@ void  OSTaskSuspend (OS_TCB  *p_tcb,
 *
 *              p_err      Pointer to a variable that will contain an error code returned by this function
 *
-*                         OS_ERR_NONE                  if the requested task is resumed
-*                         OS_ERR_STATE_INVALID         if the task is in an invalid state
-*                         OS_ERR_TASK_RESUME_ISR       if you called this function from an ISR
+*                         OS_ERR_NONE                  if the requested task is resumed, or if it is still
+*                                                      suspended by nested calls to OSTaskSuspend()
 *                         OS_ERR_TASK_RESUME_SELF      You cannot resume 'self'
 *                         OS_ERR_TASK_NOT_SUSPENDED    if the task to resume has not been suspended
 *
 * Returns    : none
+*
+* Note(s)    : 1) This function can be called from an ISR.
+*
+*              2) A task sleeping in OS_TaskSuspendWait() is woken up.  Its priority was not changed, any
+*                 priority it inherited from a mutex is kept.
+*
+*              3) A task stopped by ter_tsk is restarted by sta_tks where it was stopped, with its current
+*                 priority.  It holds no mutex, so no inherited priority is lost.  The result of the HWOS
+*                 command it may have been returning from is kept.
+*
+*              4) A task that did not go to sleep yet (still waiting for its event, or running to its next
+*                 call to the kernel) just carries on.
 *********************************************************************************************************
 */
 
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
 void  OSTaskResume (OS_TCB  *p_tcb,
                     OS_ERR  *p_err)
 {
-    CPU_INT32U  ret_val;
+    CPU_INT32U   ret_val;
+    OS_HWOS_RET  ret;
     CPU_SR_ALLOC();
 
 
-#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
-    if (OSIntNestingCtr > 0u) {                                 /* Not allowed from an ISR                              */
-       *p_err = OS_ERR_TASK_RESUME_ISR;
-        return;
-    }
-#endif
-
 #if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
     if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
         CPU_SW_EXCEPTION(;);
     }
+#endif
 
-    if ((p_tcb == DEF_NULL) || (p_tcb->CtxID == OSCtxIDCur)) {
+    if ((p_tcb == DEF_NULL) ||
+        ((OSIntNestingCtr == 0u) && (p_tcb->CtxID == OSCtxIDCur))) {
        *p_err = OS_ERR_TASK_RESUME_SELF;                        /* Can't resume self.                                   */
         return;
     }
-#endif
 
     CPU_CRITICAL_ENTER();
 
+    if (p_tcb->SuspendCtr == 0u) {                              /* Task must be suspended                               */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_SUSPENDED;
+        return;
+    }
+
+    p_tcb->SuspendCtr--;
+    if (p_tcb->SuspendCtr > 0u) {                               /* Still suspended by a nested call.                    */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    switch (p_tcb->SuspendState) {
+        case OS_TASK_SUSPEND_SLP:                               /* See Note #2.                                         */
+             if (OS_HWOS_GET_CNTX_STAT(p_tcb->CtxID) != OS_HWOS_CNTX_STAT_WAIT) {
+                 CPU_CRITICAL_EXIT();                           /* Already woken up, leaves OS_TaskSuspendWait().       */
+                *p_err = OS_ERR_NONE;
+                 return;
+             }
+             OS_PRIO_SCHED_ENTER();                             /* Order the readied tasks before dispatching them.     */
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+             OS_HWOS_CMD_SYNC();
+             OS_HWOS_SET_R4(p_tcb->CtxID);                      /* Context id of the task to wake up.                   */
+             OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_WUP_TSK);
+             break;
+
+        case OS_TASK_SUSPEND_STOP:                              /* See Note #3.                                         */
+             p_tcb->SuspendState = OS_TASK_SUSPEND_NONE;
+             OS_PRIO_SCHED_ENTER();
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+             OS_PrioRdyClr(p_tcb->CtxID);                       /* Order the task within its band.                      */
+#endif
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+             OS_HWOS_CMD_SYNC();
+             OS_HWOS_SET_R4(p_tcb->CtxID);                      /* Context id of the task to restart.                   */
+             OS_HWOS_SET_R5(0u);
+             OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_STA_TKS);
+             break;
+
+        case OS_TASK_SUSPEND_PEND:                              /* See Note #4.                                         */
+        default:
+             p_tcb->SuspendState = OS_TASK_SUSPEND_NONE;
+             CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_NONE;
+             return;
+    }
 
-    OS_HWOS_SET_R4(p_tcb->CtxID);                               /* Context id of the task to resume.                    */
-    OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_WUP_TSK);
+    ret = OSTaskRet[p_tcb->CtxID];                              /* See Note #3.                                         */
 
     OS_HWOS_CMD_PROC_ISR(ret_val);
 
+    OSTaskRet[p_tcb->CtxID] = ret;                              /* Restored before the task is switched in.             */
+    OS_PRIO_SCHED_EXIT(ret_val);
     CPU_CRITICAL_EXIT();
     OS_HWOS_TASK_SYNC();
 
@@ -611,19 +1067,334 @@ void  OSTaskResume (OS_TCB  *p_tcb,
     }
 
     switch (ret_val) {
-        case 0x0001:                                            /* Success.                                             */
+        case 0x0001:                                            /* Success, or switched in an ISR.                      */
             *p_err = OS_ERR_NONE;
              break;
 
-        case 0xFF8B:
-        case 0xFF8C:
-        case 0xFF8E:
-            *p_err = OS_ERR_TASK_NOT_SUSPENDED;
-             break;
-
         case 0xFF80:                                            /* Invalid System Call.                                 */
         default:
              CPU_SW_EXCEPTION(;);
              break;
     }
 }
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      CHANGE A TASK'S TIME SLICE
+*
+* Description: This function is called to change the value of the task's specific time slice.
+*
+* Arguments  : p_tcb        is the pointer to the TCB of the task to change. If you specify an NULL pointer, the
+*                           current task is assumed.
+*
+*              time_quanta  is the number of ticks before the CPU is taken away when round-robin scheduling is
+*                           enabled.  Specify 0 to use the default time slice.
+*
+*              p_err        is a pointer to an error code returned by this function:
+*
+*                               OS_ERR_NONE       upon success
+*                               OS_ERR_SET_ISR    if you called this function from an ISR
+*
+* Returns    : none
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+void  OSTaskTimeQuantaSet (OS_TCB   *p_tcb,
+                           OS_TICK   time_quanta,
+                           OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == DEF_NULL) {
+        p_tcb = OSTaskTCBPtrTbl[OSCtxIDCur];
+    }
+
+    p_tcb->TimeQuanta = time_quanta;                            /* Used when the current time slice expires.            */
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          INTERNAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                    INITIALIZE THE DYNAMIC TASK POOLS
+*
+* Description: This function is called by OSInit() to create the TCB pool and the stack pools used by
+*              OSTaskCreateDyn().  The pools draw their blocks from OSCfg_TaskDynMem[] as they are needed.
+*
+* Arguments  : p_err    Pointer to a variable that will contain an error code returned by this function.
+*
+*                       OS_ERR_NONE               The pools were created.
+*                       OS_ERR_MEM_INVALID_SIZE   The pools could not be created.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) Stack size class 'n' holds stacks of (OS_CFG_TASK_DYN_STK_SIZE_MIN * 2^n) elements.  The
+*                 blocks freed to a pool stay in that pool, so the classes bound the fragmentation of the
+*                 dynamic task memory.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+void  OS_TaskDynInit (OS_ERR  *p_err)
+{
+    CPU_STK_SIZE  stk_size;
+    CPU_INT08U    stk_class;
+    LIB_ERR       lib_err;
+
+
+    OSTaskDynReapListPtr = DEF_NULL;
+    OSTaskDynReapCtr     = 0u;
+
+    Mem_SegCreate("OS Task Dyn Mem",
+                  &OSTaskDynSeg,
+                  (CPU_ADDR)&OSCfg_TaskDynMem[0],
+                  sizeof(OSCfg_TaskDynMem),
+                  LIB_MEM_PADDING_ALIGN_NONE,
+                  &lib_err);
+    if (lib_err != LIB_MEM_ERR_NONE) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+
+    Mem_DynPoolCreate("OS Task TCB",
+                      &OSTaskDynTCBPool,
+                      &OSTaskDynSeg,
+                      sizeof(OS_TCB),
+                      sizeof(CPU_ALIGN),
+                      0u,
+                      OS_HWOS_CNTX_CNT,
+                      &lib_err);
+    if (lib_err != LIB_MEM_ERR_NONE) {
+       *p_err = OS_ERR_MEM_INVALID_SIZE;
+        return;
+    }
+
+    stk_size = OS_CFG_TASK_DYN_STK_SIZE_MIN;
+    for (stk_class = 0u; stk_class < OS_CFG_TASK_DYN_STK_CLASS_NBR; stk_class++) {
+        Mem_DynPoolCreate("OS Task Stk",
+                          &OSTaskDynStkPool[stk_class],
+                          &OSTaskDynSeg,
+                          stk_size * sizeof(CPU_STK),
+                          CPU_CFG_STK_ALIGN_BYTES,
+                          0u,
+                          LIB_MEM_BLK_QTY_UNLIMITED,
+                          &lib_err);
+        if (lib_err != LIB_MEM_ERR_NONE) {
+           *p_err = OS_ERR_MEM_INVALID_SIZE;
+            return;
+        }
+        stk_size *= 2u;
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                   CHECK A DYNAMIC TASK IS ALLOCATED
+*
+* Description: This function checks that a TCB is a live allocation of OSTaskCreateDyn().
+*
+* Arguments  : p_tcb    Pointer to the TCB to check.
+*
+* Returns    : DEF_YES  if the TCB was allocated by OSTaskCreateDyn() and its task was not deleted yet,
+*              DEF_NO   otherwise.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) The TCB must lie whole inside OSCfg_TaskDynMem[] and on a block boundary of the TCB pool.
+*                 The pools carve their blocks from a shared segment, so the boundary is given by the block
+*                 alignment only.  The TCB is read only once these checks pass: it must carry the
+*                 OS_OBJ_TYPE_TASK_DYN marker, cleared when the task is deleted, and still be registered for
+*                 its context.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+CPU_BOOLEAN  OS_TaskDynIsLive (OS_TCB  *p_tcb)
+{
+    CPU_ADDR  addr;
+    CPU_ADDR  addr_start;
+
+
+    addr       = (CPU_ADDR)p_tcb;
+    addr_start = (CPU_ADDR)&OSCfg_TaskDynMem[0];
+    if ((addr                    <  addr_start) ||              /* TCB must lie inside the dynamic task memory.         */
+        ((addr + sizeof(OS_TCB)) > (addr_start + sizeof(OSCfg_TaskDynMem)))) {
+        return (DEF_NO);
+    }
+
+    if (((addr - addr_start) % OSTaskDynTCBPool.BlkAlign) != 0u) {
+        return (DEF_NO);                                        /* Not on a block boundary.                             */
+    }
+
+    if (p_tcb->DynType != OS_OBJ_TYPE_TASK_DYN) {               /* Freed, being deleted or never allocated.             */
+        return (DEF_NO);
+    }
+
+    if ((p_tcb->CtxID >= OS_HWOS_CNTX_CNT) ||                   /* Task must still be registered for its context.       */
+        (OSTaskTCBPtrTbl[p_tcb->CtxID] != p_tcb)) {
+        return (DEF_NO);
+    }
+
+    return (DEF_YES);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    RECLAIM THE DELETED TASKS MEMORY
+*
+* Description: This function returns to their pool the TCB and stack of the dynamic tasks that deleted
+*              themselves.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) A task on the reaper list is gone once its TCB is no longer registered for its context,
+*                 OSTaskDel() unregisters it in the same critical section as the HWOS exit command.  As this
+*                 function runs in another task, the context switch away from the deleted task is complete.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_DYN_EN == DEF_ENABLED)
+void  OS_TaskDynReap (void)
+{
+    OS_TCB   *p_tcb;
+    OS_TCB   *p_tcb_next;
+    OS_TCB   *p_reap;
+    OS_TCB  **pp_tcb;
+    LIB_ERR   lib_err;
+    CPU_SR_ALLOC();
+
+
+    if (OSTaskDynReapCtr == 0u) {                               /* Nothing to reclaim.                                  */
+        return;
+    }
+
+    p_reap = DEF_NULL;
+    CPU_CRITICAL_ENTER();                                       /* Unlink the tasks that are gone.                      */
+    pp_tcb = &OSTaskDynReapListPtr;
+    while (*pp_tcb != DEF_NULL) {
+        p_tcb = *pp_tcb;
+        if (OSTaskTCBPtrTbl[p_tcb->CtxID] != p_tcb) {
+           *pp_tcb            = p_tcb->DynNextPtr;
+            p_tcb->DynNextPtr = p_reap;
+            p_reap            = p_tcb;
+            OSTaskDynReapCtr--;
+        } else {
+            pp_tcb = &p_tcb->DynNextPtr;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+
+    while (p_reap != DEF_NULL) {                                /* Free them outside of the critical section.           */
+        p_tcb_next = p_reap->DynNextPtr;
+        Mem_DynPoolBlkFree(&OSTaskDynStkPool[p_reap->DynStkClass], p_reap->DynStkBasePtr, &lib_err);
+        Mem_DynPoolBlkFree(&OSTaskDynTCBPool,                      p_reap,                &lib_err);
+        p_reap = p_tcb_next;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SLEEP WHILE SUSPENDED
+*
+* Description: This function puts the calling task to sleep until it is resumed by OSTaskResume().
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function is called by OSTaskSuspend() for the calling task, and through
+*                 OS_TASK_SUSPEND_CHK() for a task suspended by another task (see 'OSTaskSuspend()  Note #1').
+*                 The result of the HWOS command the task is returning from is kept.
+*
+*              3) The task sleeps without a timeout.  Other wake-ups (e.g. OSTimeDlyResume()) are ignored
+*                 until the task is resumed.
+*
+*              4) A task that holds the scheduler lock can't sleep, it does once the scheduler is unlocked.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
+void  OS_TaskSuspendWait (void)
+{
+    OS_TCB       *p_tcb;
+    OS_HWOS_RET   ret;
+    CPU_SR_ALLOC();
+
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* See Note #4.                                         */
+        return;
+    }
+
+    p_tcb = OSTaskTCBPtrTbl[OSCtxIDCur];
+    ret   = OSTaskRet[OSCtxIDCur];                              /* See Note #2.                                         */
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->SuspendState = OS_TASK_SUSPEND_SLP;                  /* From here on, only OSTaskResume() lets the task go.  */
+    CPU_CRITICAL_EXIT();
+
+    OS_SchedFlush();                                            /* Release a deferred switch before blocking.           */
+
+    CPU_CRITICAL_ENTER();
+    while (p_tcb->SuspendCtr > 0u) {                            /* See Note #3.                                         */
+                                                                /* ---------------- BUILD HWOS COMMAND ---------------- */
+        OS_HWOS_CMD_SYNC();
+        OS_HWOS_SET_R5(0xFFFFFFFFu);                            /* No timeout.                                          */
+        OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SLP_TSK);
+
+        OS_HWOS_CMD_PROC();
+        CPU_CRITICAL_EXIT();
+        OS_HWOS_TASK_SYNC();
+        CPU_CRITICAL_ENTER();
+    }
+    p_tcb->SuspendState = OS_TASK_SUSPEND_NONE;
+    CPU_CRITICAL_EXIT();
+
+    OSTaskRet[OSCtxIDCur] = ret;
+}
+#endif
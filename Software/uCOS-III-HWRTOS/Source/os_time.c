@@ -135,6 +135,13 @@ void  OSTimeDly (OS_TICK   dly,
              return;
     }
 
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked.            */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OS_SchedFlush();                                            /* Release a deferred switch before blocking.           */
+
     CPU_CRITICAL_ENTER();
 
     if (opt == OS_OPT_TIME_MATCH) {
@@ -147,6 +154,7 @@ void  OSTimeDly (OS_TICK   dly,
     }
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R5(dly);                                        /* Delay.                                               */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SLP_TSK);
 
@@ -365,8 +373,16 @@ void  OSTimeDlyHMSM (CPU_INT16U   hours,
               + (tick_rate * ((OS_TICK)milli + (OS_TICK)500u / tick_rate)) / (OS_TICK)1000u;
 
     if (ticks > 0u) {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't delay when the scheduler is locked.            */
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+
+        OS_SchedFlush();                                        /* Release a deferred switch before blocking.           */
+
         CPU_CRITICAL_ENTER();
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+        OS_HWOS_CMD_SYNC();
         OS_HWOS_SET_R5(ticks);                                  /* Delay.                                               */
         OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SLP_TSK);
 
@@ -443,6 +459,7 @@ void  OSTimeDlyResume (OS_TCB  *p_tcb,
     CPU_CRITICAL_ENTER();
 
                                                                 /* ---------------- BUILD HWOS COMMAND ---------------- */
+    OS_HWOS_CMD_SYNC();
     OS_HWOS_SET_R4(p_tcb->CtxID);                               /* Context id of the task to resume.                    */
     OS_HWOS_SET_SYSC(OS_HWOS_TSFNC_SLP_TSK);
 
@@ -519,3 +536,44 @@ void  OSTimeSet (OS_TICK   ticks,
     OS_HWOS_SET_SYS_TIM(ticks);
    *p_err = OS_ERR_NONE;
 }
+
+
+/*
+*********************************************************************************************************
+*                                         PROCESS SYSTEM TICK
+*
+* Description: This function is called by the OS tick ISR to run the parts of the scheduling that the HWOS
+*              does not handle on its own: counting the round-robin time slices and ordering, within their
+*              band, the tasks that the HWOS readied by itself since the last context switch.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function MUST be called from the OS tick ISR, between OSIntEnter() and OSIntExit().
+*
+*              2) The HWOS keeps the system time and the timeouts, they do not depend on this function.
+*********************************************************************************************************
+*/
+
+#if (OS_TICK_EN == DEF_ENABLED)
+void  OSTimeTick (void)
+{
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
+    OS_SchedRoundRobin();
+#endif
+
+#if (OS_PRIO_SUB_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();
+    if (OSCtxIDCur < OS_HWOS_CNTX_CNT) {                        /* Multitasking started.                                */
+        OS_PrioSchedChk();                                      /* Only when a band was joined.                         */
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+}
+#endif
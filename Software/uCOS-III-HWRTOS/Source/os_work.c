@@ -0,0 +1,548 @@
+/*
+*********************************************************************************************************
+*                                           uC/OS-III HW-RTOS
+*
+*                         (c) Copyright 2004-2014; Micrium, Inc.; Weston, FL
+*
+*                  All rights reserved.  Protected by international copyright laws.
+*
+*                  uC/OS-III-HWOS is provided in source form to registered licensees ONLY.  It is
+*                  illegal to distribute this source code to any third party unless you receive
+*                  written permission by an authorized Micrium representative.  Knowledge of
+*                  the source code may NOT be used to develop a similar product.
+*
+*                  Please help us continue to provide the Embedded community with the finest
+*                  software available.  Your honesty is greatly appreciated.
+*
+*                  You can find our product's user manual, API reference, release notes and
+*                  more information at: https://doc.micrium.com
+*
+*                  You can contact us at: www.micrium.com
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*
+*                                             WORK QUEUE
+*
+* Filename      : os_work.c
+*
+* Note(s)       : (1) Jobs (a function and its argument) are submitted to a bounded queue and run by a pool of
+*                     OS_CFG_WORK_TASK_NBR worker tasks.  Whichever worker is free takes the next job.
+*
+*                 (2) The queue is a lock-free multi-producer, multi-consumer ring.  Every slot holds a
+*                     sequence number telling whether it is free or full for a given position, and the
+*                     positions are claimed with OS_CPU_CmpSwap().  Jobs can thus be submitted from ISRs
+*                     without masking interrupts.
+*
+*                 (3) The idle workers wait on a HWOS semaphore, which is signaled once per submitted job.
+*                     A worker empties the queue before waiting again, so a job is never lost when the
+*                     semaphore count saturates at OS_HWOS_SEM_VAL_MAX.
+*
+*                 (4) The ISRs can also defer work to a single high priority task with OSIntDefer().  The
+*                     deferred jobs are queued in one ring per deferral priority and the task is woken by a
+*                     single semaphore post, the same way as the workers.
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  "os.h"
+
+
+#if (OS_WORK_Q_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                            SUBMIT A JOB
+*
+* Description: This function queues a job to be run by one of the worker tasks.
+*
+* Arguments  : p_fnct   Pointer to the function to run.
+*
+*              p_arg    Argument passed to the function.
+*
+*              p_err    Pointer to a variable that will contain an error code returned by this function.
+*
+*                       OS_ERR_NONE          The job was queued.
+*                       OS_ERR_PTR_INVALID   If 'p_fnct' is a NULL pointer.
+*                       OS_ERR_WORK_Q_FULL   If the queue is full.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function can be called from a task or from an ISR.
+*
+*              2) The jobs are started in the order they were submitted, but run concurrently when there is
+*                 more than one worker task.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+void  OSWorkSubmit (OS_WORK_FNCT   p_fnct,
+                    void          *p_arg,
+                    OS_ERR        *p_err)
+{
+    OS_ERR  os_err;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_fnct == DEF_NULL) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    if (OS_WorkQPut(&OSWorkQ, p_fnct, p_arg) != DEF_OK) {
+       *p_err = OS_ERR_WORK_Q_FULL;
+        return;
+    }
+
+    OSSemPost(&OSWorkSem,                                       /* Wake up a worker.  Saturating the count is fine.     */
+              OS_OPT_POST_1,
+             &os_err);
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DEFER WORK FROM AN ISR
+*
+* Description: This function queues a job to be run by the interrupt deferral task, out of the interrupt
+*              context.
+*
+* Arguments  : p_fnct   Pointer to the function to run.
+*
+*              p_arg    Argument passed to the function.
+*
+*              prio     Deferral priority, from 0 (most urgent) to OS_CFG_INT_DEFER_PRIO_NBR - 1.
+*
+*              p_err    Pointer to a variable that will contain an error code returned by this function.
+*
+*                       OS_ERR_NONE           The job was queued.
+*                       OS_ERR_INT_Q_FULL     If the queue of this priority is full.
+*                       OS_ERR_PRIO_INVALID   If 'prio' is out of range.
+*                       OS_ERR_PTR_INVALID    If 'p_fnct' is a NULL pointer.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is meant to be called from ISRs, but can be called from a task.
+*
+*              2) The ISR only fills a slot, without masking interrupts, and issues a single HWOS semaphore
+*                 post.  Its duration does not depend on the deferred work.
+*
+*              3) The jobs of a given priority run in the order they were deferred.  A job of a lower
+*                 priority only runs once the queues of the higher priorities are empty.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+void  OSIntDefer (OS_WORK_FNCT   p_fnct,
+                  void          *p_arg,
+                  OS_PRIO        prio,
+                  OS_ERR        *p_err)
+{
+    OS_ERR  os_err;
+
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)                          /* ---------------- VALIDATE ARGUMENTS ---------------- */
+    if (p_err == DEF_NULL) {                                    /* Validate err ptr.                                    */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_fnct == DEF_NULL) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    if (prio >= OS_CFG_INT_DEFER_PRIO_NBR) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+
+    if (OS_WorkQPut(&OSIntDeferQTbl[prio], p_fnct, p_arg) != DEF_OK) {
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
+    }
+
+    OSSemPost(&OSIntDeferSem,                                   /* Wake up the deferral task.                           */
+              OS_OPT_POST_1,
+             &os_err);
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          INTERNAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*                                     INITIALIZE THE WORK QUEUE
+*
+* Description: This function is called by OSInit() to create the work queue and the worker tasks.
+*
+* Arguments  : p_err    Pointer to a variable that will contain an error code returned by this function.
+*
+*                       OS_ERR_NONE   The work queue was created.
+*                       Other         Other OS_ERR_xxx returned by OSSemCreate() or OSTaskCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+void  OS_WorkInit (OS_ERR  *p_err)
+{
+    CPU_INT32U  i;
+
+
+    OS_WorkQInit(&OSWorkQ, &OSCfg_WorkQTbl[0], OS_CFG_WORK_Q_SIZE);
+
+    OSSemCreate(&OSWorkSem,
+                "Work Sem",
+                 0u,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    for (i = 0u; i < OS_CFG_WORK_TASK_NBR; i++) {
+        OSTaskCreate(&OSWorkTaskTCBTbl[i],
+                     "Work Task",
+                      OS_WorkTask,
+                      DEF_NULL,
+                      OS_CFG_WORK_TASK_PRIO,
+                     &OSCfg_WorkTaskStk[i][0],
+                      OS_CFG_WORK_TASK_STK_SIZE / 10u,
+                      OS_CFG_WORK_TASK_STK_SIZE,
+                      0u,
+                      0u,
+                      DEF_NULL,
+                      0u,
+                      p_err);
+        if (*p_err != OS_ERR_NONE) {
+            return;
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             WORKER TASK
+*
+* Description: This task runs the jobs submitted with OSWorkSubmit().
+*
+* Arguments  : p_arg    Argument passed to the task when the task is created.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_WORK_EN == DEF_ENABLED)
+void  OS_WorkTask (void  *p_arg)
+{
+    OS_WORK_FNCT   p_fnct;
+    void          *p_job_arg;
+    OS_ERR         os_err;
+
+
+    (void)p_arg;
+
+    while (DEF_ON) {
+        if (OS_WorkQGet(&OSWorkQ, &p_fnct, &p_job_arg) == DEF_OK) {
+            p_fnct(p_job_arg);
+        } else {
+            (void)OSSemPend(&OSWorkSem,                         /* Wait for the next job.                               */
+                             0u,
+                             OS_OPT_PEND_BLOCKING,
+                             DEF_NULL,
+                            &os_err);
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                 INITIALIZE THE INTERRUPT DEFERRAL TASK
+*
+* Description: This function is called by OSInit() to create the deferral queues and the deferral task.
+*
+* Arguments  : p_err    Pointer to a variable that will contain an error code returned by this function.
+*
+*                       OS_ERR_NONE   The deferral task was created.
+*                       Other         Other OS_ERR_xxx returned by OSSemCreate() or OSTaskCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+void  OS_IntDeferInit (OS_ERR  *p_err)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < OS_CFG_INT_DEFER_PRIO_NBR; i++) {
+        OS_WorkQInit(&OSIntDeferQTbl[i], &OSCfg_IntDeferQSlotTbl[i][0], OS_CFG_INT_DEFER_Q_SIZE);
+    }
+
+    OSSemCreate(&OSIntDeferSem,
+                "Int Defer Sem",
+                 0u,
+                 p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    OSTaskCreate(&OSIntDeferTaskTCB,
+                 "Int Defer Task",
+                  OS_IntDeferTask,
+                  DEF_NULL,
+                  OS_CFG_INT_DEFER_TASK_PRIO,
+                 &OSCfg_IntDeferTaskStk[0],
+                  OS_CFG_INT_DEFER_TASK_STK_SIZE / 10u,
+                  OS_CFG_INT_DEFER_TASK_STK_SIZE,
+                  0u,
+                  0u,
+                  DEF_NULL,
+                  0u,
+                  p_err);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       INTERRUPT DEFERRAL TASK
+*
+* Description: This task runs the jobs deferred with OSIntDefer(), most urgent queue first.
+*
+* Arguments  : p_arg    Argument passed to the task when the task is created.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) The queues are scanned again from the most urgent one after every job, so a job deferred
+*                 by an ISR while a less urgent job runs is picked up next.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_INT_DEFER_EN == DEF_ENABLED)
+void  OS_IntDeferTask (void  *p_arg)
+{
+    OS_WORK_FNCT   p_fnct;
+    void          *p_job_arg;
+    CPU_INT32U     prio;
+    OS_ERR         os_err;
+
+
+    (void)p_arg;
+
+    while (DEF_ON) {
+        for (prio = 0u; prio < OS_CFG_INT_DEFER_PRIO_NBR; prio++) {
+            if (OS_WorkQGet(&OSIntDeferQTbl[prio], &p_fnct, &p_job_arg) == DEF_OK) {
+                break;
+            }
+        }
+
+        if (prio < OS_CFG_INT_DEFER_PRIO_NBR) {
+            p_fnct(p_job_arg);
+        } else {
+            (void)OSSemPend(&OSIntDeferSem,                     /* Wait for the next deferred job.                      */
+                             0u,
+                             OS_OPT_PEND_BLOCKING,
+                             DEF_NULL,
+                            &os_err);
+        }
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     INITIALIZE A WORK QUEUE RING
+*
+* Description: This function initializes an empty work queue ring.
+*
+* Arguments  : p_q          Pointer to the work queue.
+*
+*              p_slot_tbl   Pointer to the slots of the queue.
+*
+*              size         Number of slots, MUST be a power of 2.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*********************************************************************************************************
+*/
+
+void  OS_WorkQInit (OS_WORK_Q   *p_q,
+                    OS_WORK     *p_slot_tbl,
+                    CPU_INT32U   size)
+{
+    CPU_INT32U  i;
+
+
+    for (i = 0u; i < size; i++) {                               /* Slot 'i' is free for position 'i'.                   */
+        p_slot_tbl[i].FnctPtr = DEF_NULL;
+        p_slot_tbl[i].ArgPtr  = DEF_NULL;
+        p_slot_tbl[i].Seq     = i;
+    }
+
+    p_q->SlotTbl = p_slot_tbl;
+    p_q->Mask    = size - 1u;
+    p_q->InIx    = 0u;
+    p_q->OutIx   = 0u;
+}
+
+
+/*
+*********************************************************************************************************
+*                                    PUT A JOB IN A WORK QUEUE RING
+*
+* Description: This function adds a job at the tail of a work queue ring.
+*
+* Arguments  : p_q          Pointer to the work queue.
+*
+*              p_fnct       Pointer to the function to run.
+*
+*              p_arg        Argument passed to the function.
+*
+* Returns    : DEF_OK,   if the job was queued.
+*              DEF_FAIL, if the queue is full.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function can be called concurrently from tasks and ISRs.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_WorkQPut (OS_WORK_Q     *p_q,
+                          OS_WORK_FNCT   p_fnct,
+                          void          *p_arg)
+{
+    OS_WORK     *p_slot;
+    CPU_INT32U   pos;
+    CPU_INT32S   diff;
+
+
+    while (DEF_ON) {
+        pos    =  p_q->InIx;
+        p_slot = &p_q->SlotTbl[pos & p_q->Mask];
+        diff   = (CPU_INT32S)(p_slot->Seq - pos);
+        if (diff == 0) {                                        /* Slot is free, try to claim the position.             */
+            if (OS_CPU_CmpSwap(&p_q->InIx, pos, pos + 1u) == DEF_OK) {
+                break;
+            }
+        } else if (diff < 0) {                                  /* Slot still holds the job of the previous lap.        */
+            return (DEF_FAIL);
+        } else {
+            ;                                                   /* Position taken by another producer, retry.           */
+        }
+    }
+
+    p_slot->FnctPtr = p_fnct;
+    p_slot->ArgPtr  = p_arg;
+    p_slot->Seq     = pos + 1u;                                 /* Publish the job.                                     */
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                   GET A JOB FROM A WORK QUEUE RING
+*
+* Description: This function removes the job at the head of a work queue ring.
+*
+* Arguments  : p_q          Pointer to the work queue.
+*
+*              p_fnct       Pointer to a variable that will receive the function to run.
+*
+*              p_arg        Pointer to a variable that will receive the argument of the function.
+*
+* Returns    : DEF_OK,   if a job was removed.
+*              DEF_FAIL, if the queue is empty.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III HW-RTOS and your application MUST NOT call it.
+*
+*              2) This function can be called concurrently from tasks and ISRs.
+*
+*              3) A job being written by a producer that was preempted is not seen until it is published.
+*                 The producer signals the consumers once it is.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_WorkQGet (OS_WORK_Q      *p_q,
+                          OS_WORK_FNCT   *p_fnct,
+                          void          **p_arg)
+{
+    OS_WORK     *p_slot;
+    CPU_INT32U   pos;
+    CPU_INT32S   diff;
+
+
+    while (DEF_ON) {
+        pos    =  p_q->OutIx;
+        p_slot = &p_q->SlotTbl[pos & p_q->Mask];
+        diff   = (CPU_INT32S)(p_slot->Seq - (pos + 1u));
+        if (diff == 0) {                                        /* Slot is full, try to claim the position.             */
+            if (OS_CPU_CmpSwap(&p_q->OutIx, pos, pos + 1u) == DEF_OK) {
+                break;
+            }
+        } else if (diff < 0) {                                  /* Slot not published yet, queue is empty.              */
+            return (DEF_FAIL);
+        } else {
+            ;                                                   /* Position taken by another consumer, retry.           */
+        }
+    }
+
+   *p_fnct = p_slot->FnctPtr;
+   *p_arg  = p_slot->ArgPtr;
+    p_slot->Seq = pos + p_q->Mask + 1u;                         /* Free the slot for the next lap.                      */
+
+    return (DEF_OK);
+}
+#endif